@@ -57,6 +57,8 @@ testSwiftSettings = nil
 let objectServerTestSources = [
     "Object-Server-Tests-Bridging-Header.h",
     "ObjectServerTests-Info.plist",
+    "RLMAppResponseCacheTests.mm",
+    "RLMAsyncLogBufferTests.mm",
     "RLMBSONTests.mm",
     "RLMCollectionSyncTests.mm",
     "RLMObjectServerPartitionTests.mm",
@@ -70,6 +72,8 @@ let objectServerTestSources = [
     "RLMWatchTestUtility.h",
     "RLMWatchTestUtility.m",
     "RealmServer.swift",
+    "StubAppServer.swift",
+    "SwiftAppTransportBenchmarks.swift",
     "SwiftCollectionSyncTests.swift",
     "SwiftObjectServerPartitionTests.swift",
     "SwiftObjectServerTests.swift",
@@ -297,6 +301,7 @@ let package = Package(
             name: "RealmSwiftSyncTestSupport",
             dependencies: ["RealmSwift", "RealmTestSupport", "RealmSyncTestSupport"],
             sources: [
+                 "StubAppServer.swift",
                  "SwiftSyncTestCase.swift",
                  "TimeoutProxyServer.swift",
                  "WatchTestUtility.swift",
@@ -314,9 +319,15 @@ let package = Package(
                 "SwiftMongoClientTests.swift"
             ]
         ),
+        objectServerTestTarget(
+            name: "SwiftAppTransportBenchmarks",
+            sources: ["SwiftAppTransportBenchmarks.swift"]
+        ),
         objectServerTestTarget(
             name: "ObjcObjectServerTests",
             sources: [
+                "RLMAppResponseCacheTests.mm",
+                "RLMAsyncLogBufferTests.mm",
                 "RLMBSONTests.mm",
                 "RLMCollectionSyncTests.mm",
                 "RLMObjectServerPartitionTests.mm",
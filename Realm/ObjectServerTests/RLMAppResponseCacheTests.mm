@@ -0,0 +1,169 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2022 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#import "RLMApp_Private.hpp"
+
+#import <realm/object-store/sync/generic_network_transport.hpp>
+
+#import <XCTest/XCTest.h>
+
+#import <atomic>
+#import <vector>
+
+using namespace realm;
+using Callback = RLMAppResponseCache::Callback;
+
+@interface RLMAppResponseCacheTests : XCTestCase
+@end
+
+@implementation RLMAppResponseCacheTests {
+    std::shared_ptr<RLMAppResponseCache> _cache;
+    // The callbacks for requests passed to `send` which have not completed
+    std::vector<Callback> _requests;
+    size_t _sendCount;
+}
+
+- (void)setUp {
+    [super setUp];
+    _cache = std::make_shared<RLMAppResponseCache>();
+    _requests.clear();
+    _sendCount = 0;
+}
+
+- (void)tearDown {
+    _cache.reset();
+    _requests.clear();
+    [super tearDown];
+}
+
+// Performs a request with the given key, returning an expectation which is
+// fulfilled with the response. The request is left in `_requests` if it was
+// sent rather than being answered from the cache or attached to another one.
+- (XCTestExpectation *)perform:(std::string)key expecting:(bson::Bson)expected {
+    XCTestExpectation *ex = [self expectationWithDescription:@(key.c_str())];
+    _cache->perform([&] { return key; },
+                    [=](const util::Optional<app::AppError>&, const util::Optional<bson::Bson>& response) {
+        XCTAssertTrue(response && *response == expected);
+        [ex fulfill];
+    }, [&](Callback callback) {
+        ++_sendCount;
+        _requests.push_back(std::move(callback));
+    });
+    return ex;
+}
+
+- (void)complete:(size_t)index with:(bson::Bson)response {
+    auto callback = std::move(_requests[index]);
+    callback(util::none, response);
+}
+
+- (void)testCachedResponsesAreReportedAsynchronously {
+    _cache->time_to_live = 60;
+    [self perform:"a" expecting:bson::Bson(1)];
+    [self complete:0 with:bson::Bson(1)];
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+
+    std::atomic<bool> called{false};
+    XCTestExpectation *ex = [self expectationWithDescription:@"cached"];
+    _cache->perform([] { return std::string("a"); },
+                    [&, ex](const util::Optional<app::AppError>&, const util::Optional<bson::Bson>& response) {
+        XCTAssertTrue(response && *response == bson::Bson(1));
+        called = true;
+        [ex fulfill];
+    }, [&](Callback) {
+        XCTFail(@"Cached request should not be sent");
+    });
+    XCTAssertFalse(called);
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+    XCTAssertEqual(_sendCount, 1U);
+}
+
+- (void)testErrorsAreNotCached {
+    _cache->time_to_live = 60;
+    XCTestExpectation *ex = [self expectationWithDescription:@"error"];
+    _cache->perform([] { return std::string("a"); },
+                    [=](const util::Optional<app::AppError>& error, const util::Optional<bson::Bson>&) {
+        XCTAssertTrue(error);
+        [ex fulfill];
+    }, [&](Callback callback) {
+        ++_sendCount;
+        callback(app::AppError(make_error_code(app::JSONErrorCode::bad_bson_parse), "error"), util::none);
+    });
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+    XCTAssertEqual(_cache->cached_response_count(), 0U);
+
+    [self perform:"a" expecting:bson::Bson(2)];
+    XCTAssertEqual(_sendCount, 2U);
+    [self complete:0 with:bson::Bson(2)];
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+}
+
+- (void)testInvalidateDetachesInFlightRequests {
+    _cache->coalesce_requests = true;
+    _cache->time_to_live = 60;
+    [self perform:"a" expecting:bson::Bson(1)];
+    [self perform:"a" expecting:bson::Bson(1)];
+    XCTAssertEqual(_sendCount, 1U);
+
+    // A request made after invalidating is not attached to the earlier one,
+    // and the earlier one's response is not cached
+    _cache->invalidate();
+    [self perform:"a" expecting:bson::Bson(2)];
+    XCTAssertEqual(_sendCount, 2U);
+    [self complete:0 with:bson::Bson(1)];
+    XCTAssertEqual(_cache->cached_response_count(), 0U);
+    [self complete:1 with:bson::Bson(2)];
+    XCTAssertEqual(_cache->cached_response_count(), 1U);
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+}
+
+- (void)testCachedResponsesExpire {
+    _cache->time_to_live = 0.1;
+    [self perform:"a" expecting:bson::Bson(1)];
+    [self complete:0 with:bson::Bson(1)];
+    [self perform:"a" expecting:bson::Bson(1)];
+    XCTAssertEqual(_sendCount, 1U);
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+
+    [NSThread sleepForTimeInterval:0.2];
+    [self perform:"a" expecting:bson::Bson(2)];
+    XCTAssertEqual(_sendCount, 2U);
+    [self complete:1 with:bson::Bson(2)];
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+}
+
+- (void)testCacheSizeIsLimited {
+    _cache->time_to_live = 60;
+    _cache->max_entries = 2;
+    for (size_t i = 0; i < 3; ++i) {
+        [self perform:std::to_string(i) expecting:bson::Bson(int64_t(i))];
+        [self complete:i with:bson::Bson(int64_t(i))];
+    }
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+    XCTAssertEqual(_cache->cached_response_count(), 2U);
+
+    // The response which expires soonest is the one evicted
+    [self perform:"0" expecting:bson::Bson(int64_t(0))];
+    XCTAssertEqual(_sendCount, 4U);
+    [self perform:"2" expecting:bson::Bson(int64_t(2))];
+    XCTAssertEqual(_sendCount, 4U);
+    [self complete:3 with:bson::Bson(int64_t(0))];
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+}
+
+@end
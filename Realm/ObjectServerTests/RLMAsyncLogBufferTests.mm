@@ -0,0 +1,177 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2022 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#import "RLMSyncManager_Private.hpp"
+
+#import <XCTest/XCTest.h>
+
+using Level = realm::util::Logger::Level;
+
+@interface RLMAsyncLogBufferTests : XCTestCase
+@end
+
+@implementation RLMAsyncLogBufferTests {
+    NSMutableArray<NSString *> *_messages;
+    std::shared_ptr<std::atomic<uint64_t>> _dropped;
+}
+
+- (void)setUp {
+    [super setUp];
+    _messages = [NSMutableArray new];
+    _dropped = std::make_shared<std::atomic<uint64_t>>(0);
+}
+
+// Returns a buffer whose log function records each message and fulfills
+// `expectation` once `count` messages have been delivered. If `block` is
+// given, it is called before recording each message.
+- (std::shared_ptr<RLMAsyncLogBuffer>)bufferWithCapacity:(size_t)capacity
+                                           expectedCount:(NSUInteger)count
+                                             expectation:(XCTestExpectation *)expectation
+                                                   block:(void (^)(NSString *))block {
+    NSMutableArray<NSString *> *messages = _messages;
+    auto logFn = ^(RLMSyncLogLevel, NSString *message) {
+        if (block) {
+            block(message);
+        }
+        @synchronized (messages) {
+            [messages addObject:message];
+            if (messages.count == count) {
+                [expectation fulfill];
+            }
+        }
+    };
+    return std::make_shared<RLMAsyncLogBuffer>(logFn, capacity, _dropped);
+}
+
+- (NSUInteger)deliveredCount {
+    @synchronized (_messages) {
+        return _messages.count;
+    }
+}
+
+- (void)testMessagesAreDeliveredInOrder {
+    XCTestExpectation *ex = [self expectationWithDescription:@"delivered"];
+    auto buffer = [self bufferWithCapacity:256 expectedCount:1000 expectation:ex block:nil];
+    NSMutableArray *expected = [NSMutableArray new];
+    for (int i = 0; i < 1000; ++i) {
+        // Pushing more messages than fit in the buffer at once would drop
+        // some, so wait for the drain to catch up every so often
+        while (i - static_cast<int>(self.deliveredCount) >= 200) {
+            usleep(100);
+        }
+        buffer->push(Level::info, std::to_string(i));
+        [expected addObject:@(i).stringValue];
+    }
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+    XCTAssertEqualObjects(_messages, expected);
+    XCTAssertEqual(_dropped->load(), 0U);
+}
+
+- (void)testFullBufferDropsMessagesAndWarns {
+    dispatch_semaphore_t entered = dispatch_semaphore_create(0);
+    dispatch_semaphore_t resume = dispatch_semaphore_create(0);
+    XCTestExpectation *ex = [self expectationWithDescription:@"delivered"];
+    auto buffer = [self bufferWithCapacity:4 expectedCount:6 expectation:ex block:^(NSString *message) {
+        if ([message isEqualToString:@"0"]) {
+            dispatch_semaphore_signal(entered);
+            dispatch_semaphore_wait(resume, DISPATCH_TIME_FOREVER);
+        }
+    }];
+
+    // Block the drain on the first message so that the buffer fills up
+    buffer->push(Level::info, "0");
+    dispatch_semaphore_wait(entered, DISPATCH_TIME_FOREVER);
+    for (int i = 1; i <= 6; ++i) {
+        buffer->push(Level::info, std::to_string(i));
+    }
+    XCTAssertEqual(_dropped->load(), 2U);
+    dispatch_semaphore_signal(resume);
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+    XCTAssertEqualObjects(_messages, (@[@"0", @"1", @"2", @"3", @"4",
+                                        @"2 sync log messages were discarded because the log buffer was full"]));
+
+    // A buffer which replaces this one adds to the same count, but only warns
+    // about the messages it discarded itself
+    XCTestExpectation *warned = [self expectationWithDescription:@"warned"];
+    auto replacement = std::make_shared<RLMAsyncLogBuffer>(^(RLMSyncLogLevel, NSString *message) {
+        if ([message isEqualToString:@"a"]) {
+            dispatch_semaphore_signal(entered);
+            dispatch_semaphore_wait(resume, DISPATCH_TIME_FOREVER);
+        }
+        else if ([message hasPrefix:@"1 sync log messages were discarded"]) {
+            [warned fulfill];
+        }
+    }, 2, _dropped);
+    replacement->push(Level::info, "a");
+    dispatch_semaphore_wait(entered, DISPATCH_TIME_FOREVER);
+    replacement->push(Level::info, "b");
+    replacement->push(Level::info, "c");
+    replacement->push(Level::info, "d");
+    XCTAssertEqual(_dropped->load(), 3U);
+    dispatch_semaphore_signal(resume);
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+}
+
+- (void)testPushDuringDrainSchedulesAnotherDrain {
+    // Each message is pushed from another thread while the drain which
+    // delivered the previous one is still running, so it may land after the
+    // drain has read its slot and must then schedule another drain
+    XCTestExpectation *ex = [self expectationWithDescription:@"delivered"];
+    __block std::shared_ptr<RLMAsyncLogBuffer> buffer;
+    buffer = [self bufferWithCapacity:4 expectedCount:100 expectation:ex block:^(NSString *message) {
+        int i = message.intValue;
+        if (i < 99) {
+            dispatch_async(dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0), ^{
+                buffer->push(Level::info, std::to_string(i + 1));
+            });
+        }
+    }];
+    buffer->push(Level::info, "0");
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+    XCTAssertEqual(_messages.count, 100U);
+    XCTAssertEqual(_dropped->load(), 0U);
+    buffer.reset();
+}
+
+- (void)testConcurrentPushesAreAllDelivered {
+    XCTestExpectation *ex = [self expectationWithDescription:@"delivered"];
+    auto buffer = [self bufferWithCapacity:4096 expectedCount:4000 expectation:ex block:nil];
+    dispatch_apply(4, dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0), ^(size_t thread) {
+        for (int i = 0; i < 1000; ++i) {
+            buffer->push(Level::info, std::to_string(thread) + ":" + std::to_string(i));
+        }
+    });
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+    XCTAssertEqual(_dropped->load(), 0U);
+
+    // Messages from each thread are delivered in the order they were pushed
+    for (size_t thread = 0; thread < 4; ++thread) {
+        NSString *prefix = [NSString stringWithFormat:@"%zu:", thread];
+        int next = 0;
+        for (NSString *message in _messages) {
+            if ([message hasPrefix:prefix]) {
+                XCTAssertEqual([message substringFromIndex:prefix.length].intValue, next);
+                ++next;
+            }
+        }
+        XCTAssertEqual(next, 1000);
+    }
+}
+
+@end
@@ -16,9 +16,14 @@
 //
 ////////////////////////////////////////////////////////////////////////////
 
+#import "RLMAssertions.h"
 #import "RLMBSON_Private.hpp"
+#import "RLMMongoCollection_Private.hpp"
+#import "RLMObjectId_Private.hpp"
 #import "RLMUUID_Private.hpp"
 
+#import <Realm/Realm.h>
+
 #import <realm/object-store/util/bson/bson.hpp>
 
 #import <XCTest/XCTest.h>
@@ -29,6 +34,50 @@ using namespace realm::bson;
 
 @end
 
+@interface RLMBSONImportObject : RLMObject
+@property RLMObjectId *_id;
+@property NSString *name;
+@property NSInteger age;
+@property double score;
+@property float weight;
+@property RLMArray<NSString *><RLMString> *tags;
+@end
+
+@implementation RLMBSONImportObject
++ (NSString *)primaryKey {
+    return @"_id";
+}
++ (NSDictionary *)defaultPropertyValues {
+    return @{@"score": @10.0, @"weight": @0.0f};
+}
+@end
+
+@interface RLMBatchedChangeEventDelegate : NSObject <RLMChangeEventDelegate>
+@property (nonatomic) NSMutableArray<NSArray *> *batches;
+@property (nonatomic) NSMutableArray<NSError *> *errors;
+@end
+
+@implementation RLMBatchedChangeEventDelegate
+- (instancetype)init {
+    if (self = [super init]) {
+        _batches = [NSMutableArray new];
+        _errors = [NSMutableArray new];
+    }
+    return self;
+}
+- (void)changeStreamDidOpen:(RLMChangeStream *)changeStream {}
+- (void)changeStreamDidCloseWithError:(NSError *)error {}
+- (void)changeStreamDidReceiveError:(NSError *)error {
+    [_errors addObject:error];
+}
+- (void)changeStreamDidReceiveChangeEvent:(id<RLMBSON>)changeEvent {
+    [_batches addObject:@[changeEvent]];
+}
+- (void)changeStreamDidReceiveChangeEvents:(NSArray<id<RLMBSON>> *)changeEvents {
+    [_batches addObject:changeEvents];
+}
+@end
+
 @implementation RLMBSONTestCase
 
 - (void)testNilRoundTrip {
@@ -156,4 +205,182 @@ using namespace realm::bson;
     XCTAssertEqualObjects(RLMConvertBsonToRLMBSON(bsonDocument["uuid"]), document[@"uuid"]);
 }
 
+- (void)testBinaryRoundTrip {
+    std::string buffer;
+    RLMAppendBson(buffer, BsonDocument{{"a", int32_t(1)}});
+    const char expected[] = {0x0C, 0, 0, 0, 0x10, 'a', 0, 1, 0, 0, 0, 0};
+    XCTAssertEqual(buffer, std::string(expected, sizeof(expected)));
+
+    NSDictionary<NSString *, id<RLMBSON>> *document = @{
+        @"nil": [NSNull null],
+        @"string": @"test string",
+        @"true": @YES,
+        @"int32": @5,
+        @"int64": @10,
+        @"double": @15.0,
+        @"decimal128": [[RLMDecimal128 alloc] initWithString:@"1.2E+10" error:nil],
+        @"minkey": [RLMMinKey new],
+        @"maxkey": [RLMMaxKey new],
+        @"date": [[NSDate alloc] initWithTimeIntervalSince1970: 500],
+        @"nesteddoc": @{@"a": @1, @"d": @[@3, @4], @"e" : @{@"f": @"g"}},
+        @"oid": [[RLMObjectId alloc] initWithString:@"507f1f77bcf86cd799439011" error:nil],
+        @"regex": [[NSRegularExpression alloc] initWithPattern:@"^abc" options:NSRegularExpressionCaseInsensitive error:nil],
+        @"binary": [NSData dataWithBytes:"abc" length:3],
+        @"uuid": [[NSUUID alloc] initWithUUIDString:@"137DECC8-B300-4954-A233-F89909F4FD89"],
+    };
+    BsonArray array{RLMConvertRLMBSONToBson(document), int64_t(5), std::string("x")};
+
+    buffer.clear();
+    RLMAppendBson(buffer, array);
+    BsonArray decoded = RLMBsonArrayWithData(RLMDataWithBsonBuffer(std::move(buffer)));
+    XCTAssertEqual(decoded.size(), array.size());
+    for (size_t i = 0; i < array.size(); ++i) {
+        XCTAssertEqual(decoded[i], array[i]);
+    }
+
+    RLMAssertThrowsWithReason(RLMAppendBson(buffer, int32_t(7)),
+                              @"Only documents and arrays can be encoded as binary BSON");
+
+    // Function responses are always wrapped in a document, so that a document
+    // or array response can be told apart from any other value
+    NSData *data = RLMFunctionResponseData(int32_t(7));
+    const char wrappedInt[] = {0x10, 0, 0, 0, 0x10, 'v', 'a', 'l', 'u', 'e', 0, 7, 0, 0, 0, 0};
+    XCTAssertEqualObjects(data, [NSData dataWithBytes:wrappedInt length:sizeof(wrappedInt)]);
+    for (Bson response : {Bson(BsonDocument{{"a", int32_t(1)}}), Bson(BsonArray{int32_t(1), "x"})}) {
+        decoded = RLMBsonArrayWithData(RLMFunctionResponseData(response));
+        XCTAssertEqual(decoded.size(), 1U);
+        XCTAssertEqual(decoded[0], response);
+    }
+
+    RLMAssertThrowsWithReason(RLMBsonArrayWithData([NSData dataWithBytes:"\x05\x00" length:2]),
+                              @"Invalid BSON data");
+    RLMAssertThrowsWithReason(RLMBsonArrayWithData([NSData dataWithBytes:"\x08\x00\x00\x00\x06a\x00\x00" length:8]),
+                              @"Unsupported BSON type 0x06");
+}
+
+- (void)testChangeStreamEventParsing {
+    RLMBatchedChangeEventDelegate *delegate = [RLMBatchedChangeEventDelegate new];
+    dispatch_queue_t queue = dispatch_queue_create("change stream", DISPATCH_QUEUE_SERIAL);
+    RLMChangeStream *stream = [[RLMChangeStream alloc] initWithChangeEventSubscriber:delegate delegateQueue:queue];
+    auto send = ^(NSString *chunk) {
+        [stream didReceiveEvent:[chunk dataUsingEncoding:NSUTF8StringEncoding]];
+    };
+
+    // Several events in one chunk, with comments, CRLF line endings and
+    // percent-encoded data, are delivered as one batch
+    send(@": comment\r\ndata: {\"a\": 1}\r\n\r\nevent: message\ndata: {\"b\": \"%25\"}\n\n");
+    // Events and lines split across chunks are delivered once complete
+    send(@"data: {\"c\"");
+    send(@": 3}\r");
+    send(@"\n\r\n");
+    dispatch_sync(queue, ^{});
+
+    XCTAssertEqual(delegate.batches.count, 2U);
+    XCTAssertEqualObjects(delegate.batches[0], (@[@{@"a": @1}, @{@"b": @"%"}]));
+    XCTAssertEqualObjects(delegate.batches[1], (@[@{@"c": @3}]));
+    XCTAssertEqual(delegate.errors.count, 0U);
+
+    send(@"event: error\ndata: {\"error\": \"bad\", \"error_code\": \"Unknown\"}\n\ndata: {}\n\n");
+    dispatch_sync(queue, ^{});
+    XCTAssertEqual(delegate.batches.count, 2U);
+    XCTAssertEqual(delegate.errors.count, 1U);
+    XCTAssertEqualObjects(delegate.errors[0].localizedDescription, @"bad");
+}
+
+- (void)testImportDocuments {
+    RLMRealmConfiguration *config = [RLMRealmConfiguration new];
+    config.inMemoryIdentifier = NSStringFromSelector(_cmd);
+    config.objectClasses = @[RLMBSONImportObject.class];
+    RLMRealm *realm = [RLMRealm realmWithConfiguration:config error:nil];
+
+    realm::ObjectId oid1 = realm::ObjectId::gen(), oid2 = realm::ObjectId::gen();
+    BsonArray documents{
+        BsonDocument{{"_id", oid1}, {"name", "fido"}, {"years", 3}, {"score", 1.5},
+                     {"tags", BsonArray{"a", "b"}}, {"unknown", true}},
+        BsonDocument{{"_id", oid2}, {"name", "rex"}, {"years", int64_t(5)}, {"score", 2}},
+    };
+    [realm beginWriteTransaction];
+    XCTAssertEqual(RLMImportBsonDocuments(realm, @"RLMBSONImportObject", documents, @{@"years": @"age"}), 2U);
+    [realm commitWriteTransaction];
+
+    RLMResults<RLMBSONImportObject *> *objects = [RLMBSONImportObject allObjectsInRealm:realm];
+    XCTAssertEqual(objects.count, 2U);
+    RLMBSONImportObject *fido = [RLMBSONImportObject objectInRealm:realm forPrimaryKey:[[RLMObjectId alloc] initWithValue:oid1]];
+    XCTAssertEqualObjects(fido.name, @"fido");
+    XCTAssertEqual(fido.age, 3);
+    XCTAssertEqual(fido.score, 1.5);
+    XCTAssertEqualObjects([fido.tags valueForKey:@"self"], (@[@"a", @"b"]));
+    RLMBSONImportObject *rex = [RLMBSONImportObject objectInRealm:realm forPrimaryKey:[[RLMObjectId alloc] initWithValue:oid2]];
+    XCTAssertEqual(rex.age, 5);
+    XCTAssertEqual(rex.score, 2.0);
+
+    // Importing a document with an existing primary key updates the object
+    [realm beginWriteTransaction];
+    RLMImportBsonDocuments(realm, @"RLMBSONImportObject",
+                           BsonArray{BsonDocument{{"_id", oid2}, {"name", "max"}}}, nil);
+    [realm commitWriteTransaction];
+    XCTAssertEqual(objects.count, 2U);
+    XCTAssertEqualObjects(rex.name, @"max");
+    XCTAssertEqual(rex.age, 5);
+
+    // Properties which a document for a new object doesn't have are set to
+    // their default values
+    realm::ObjectId oid3 = realm::ObjectId::gen();
+    [realm beginWriteTransaction];
+    RLMImportBsonDocuments(realm, @"RLMBSONImportObject",
+                           BsonArray{BsonDocument{{"_id", oid3}, {"age", 7}}}, nil);
+    [realm commitWriteTransaction];
+    RLMBSONImportObject *spot = [RLMBSONImportObject objectInRealm:realm forPrimaryKey:[[RLMObjectId alloc] initWithValue:oid3]];
+    XCTAssertEqual(spot.age, 7);
+    XCTAssertEqual(spot.score, 10.0);
+    XCTAssertNil(spot.name);
+
+    [realm beginWriteTransaction];
+    RLMAssertThrowsWithReason(RLMImportBsonDocuments(realm, @"RLMBSONImportObject",
+                                                     BsonArray{BsonDocument{{"_id", realm::ObjectId::gen()}, {"score", 1.0}}}, nil),
+                              @"Missing value for property 'RLMBSONImportObject.age'");
+    RLMAssertThrowsWithReason(RLMImportBsonDocuments(realm, @"RLMBSONImportObject",
+                                                     BsonArray{BsonDocument{{"name", "none"}}}, nil),
+                              @"Document is missing the field '_id'");
+    RLMAssertThrowsWithReason(RLMImportBsonDocuments(realm, @"RLMBSONImportObject",
+                                                     BsonArray{BsonDocument{{"_id", oid1}, {"age", "old"}}}, nil),
+                              @"Invalid value 'old' of type");
+    [realm cancelWriteTransaction];
+}
+
+- (void)testImportDocumentsRejectsLossyNumericConversions {
+    RLMRealmConfiguration *config = [RLMRealmConfiguration new];
+    config.inMemoryIdentifier = NSStringFromSelector(_cmd);
+    config.objectClasses = @[RLMBSONImportObject.class];
+    RLMRealm *realm = [RLMRealm realmWithConfiguration:config error:nil];
+
+    // Numbers which can be stored exactly are converted to the property's type
+    realm::ObjectId oid = realm::ObjectId::gen();
+    [realm beginWriteTransaction];
+    RLMImportBsonDocuments(realm, @"RLMBSONImportObject",
+                           BsonArray{BsonDocument{{"_id", oid}, {"age", 2.0}, {"weight", 0.5},
+                                                  {"score", int64_t(1) << 53}}}, nil);
+    [realm commitWriteTransaction];
+    RLMBSONImportObject *obj = [RLMBSONImportObject objectInRealm:realm forPrimaryKey:[[RLMObjectId alloc] initWithValue:oid]];
+    XCTAssertEqual(obj.age, 2);
+    XCTAssertEqual(obj.weight, 0.5f);
+    XCTAssertEqual(obj.score, 0x1p53);
+
+    [realm beginWriteTransaction];
+    RLMAssertThrowsWithReason(RLMImportBsonDocuments(realm, @"RLMBSONImportObject",
+                                                     BsonArray{BsonDocument{{"_id", oid}, {"weight", 0.1}}}, nil),
+                              @"for 'float' property 'RLMBSONImportObject.weight'");
+    RLMAssertThrowsWithReason(RLMImportBsonDocuments(realm, @"RLMBSONImportObject",
+                                                     BsonArray{BsonDocument{{"_id", oid}, {"weight", 16777217}}}, nil),
+                              @"for 'float' property 'RLMBSONImportObject.weight'");
+    RLMAssertThrowsWithReason(RLMImportBsonDocuments(realm, @"RLMBSONImportObject",
+                                                     BsonArray{BsonDocument{{"_id", oid}, {"age", 1.5}}}, nil),
+                              @"for 'int' property 'RLMBSONImportObject.age'");
+    RLMAssertThrowsWithReason(RLMImportBsonDocuments(realm, @"RLMBSONImportObject",
+                                                     BsonArray{BsonDocument{{"_id", oid}, {"score", (int64_t(1) << 53) + 1}}}, nil),
+                              @"for 'double' property 'RLMBSONImportObject.score'");
+    [realm cancelWriteTransaction];
+    XCTAssertEqual(obj.weight, 0.5f);
+}
+
 @end
@@ -1604,6 +1604,35 @@ static const NSInteger NUMBER_OF_BIG_OBJECTS = 2;
     XCTAssertGreaterThanOrEqual(transferred.load(), transferrable.load());
 }
 
+- (void)testSessionStatistics {
+    RLMCredentials *credentials = [self basicCredentialsWithName:NSStringFromSelector(_cmd)
+                                                        register:self.isParent];
+    RLMUser *user = [self logInUserForCredentials:credentials];
+    RLMRealm *realm = [self openRealmForPartitionValue:NSStringFromSelector(_cmd) user:user];
+    RLMSyncSession *session = realm.syncSession;
+    XCTAssertNotNil(session);
+    // Collection starts with the first request for the session's statistics
+    XCTAssertEqual(session.statistics.bytesUploaded, 0U);
+
+    [realm beginWriteTransaction];
+    for (NSInteger i=0; i<NUMBER_OF_BIG_OBJECTS; i++) {
+        [realm addObject:[HugeSyncObject hugeSyncObject]];
+    }
+    [realm commitWriteTransaction];
+    [self waitForUploadsForRealm:realm];
+
+    NSPredicate *uploaded = [NSPredicate predicateWithFormat:@"statistics.bytesUploaded > %@ AND statistics.pendingUploadBytes == 0",
+                             @(1000000 * NUMBER_OF_BIG_OBJECTS)];
+    [self expectationForPredicate:uploaded evaluatedWithObject:session handler:nil];
+    [self waitForExpectationsWithTimeout:10.0 handler:nil];
+
+    RLMSyncSessionStatistics *statistics = session.statistics;
+    XCTAssertGreaterThan(statistics.uploadBatchCount, 0U);
+    XCTAssertEqual(statistics.reconnectCount, 0U);
+    XCTAssertGreaterThan(statistics.duration, 0);
+    XCTAssertGreaterThanOrEqual(self.app.syncManager.statistics.bytesUploaded, statistics.bytesUploaded);
+}
+
 #pragma mark - Download Realm
 
 - (void)testDownloadRealm {
@@ -1765,6 +1794,55 @@ static const NSInteger NUMBER_OF_BIG_OBJECTS = 2;
     [self waitForExpectationsWithTimeout:2.0 handler:nil];
 }
 
+- (void)testPrefetchRealms {
+    RLMCredentials *credentials = [self basicCredentialsWithName:NSStringFromSelector(_cmd)
+                                                        register:self.isParent];
+    RLMUser *user = [self logInUserForCredentials:credentials];
+
+    if (!self.isParent) {
+        [self populateDataForUser:user partitionValue:NSStringFromSelector(_cmd)];
+        return;
+    }
+
+    RLMRunChildAndWait();
+
+    NSMutableArray<RLMRealmConfiguration *> *configurations = [NSMutableArray new];
+    for (NSString *suffix in @[@"", @"-a", @"-b"]) {
+        RLMRealmConfiguration *c = [user configurationWithPartitionValue:[NSStringFromSelector(_cmd) stringByAppendingString:suffix]];
+        c.objectClasses = @[Person.class, HugeSyncObject.class];
+        [configurations addObject:c];
+    }
+
+    XCTestExpectation *ex = [self expectationWithDescription:@"prefetch"];
+    __block NSUInteger lastCompleted = 0;
+    RLMSyncManager *syncManager = self.app.syncManager;
+    RLMPrefetchTask *task = [syncManager prefetchRealmsWithConfigurations:configurations
+                                                              priorities:@[@2, @1, @1]
+                                                  maxConcurrentDownloads:1
+                                                     maxOutstandingBytes:0
+                                                                progress:^(NSUInteger completed, NSUInteger total, NSUInteger, NSUInteger) {
+        XCTAssertEqual(total, 3U);
+        XCTAssertGreaterThanOrEqual(completed, lastCompleted);
+        lastCompleted = completed;
+    } completion:^(NSDictionary<NSNumber *, NSError *> *errors) {
+        XCTAssertEqual(errors.count, 0U);
+        [ex fulfill];
+    }];
+    XCTAssertNotNil(task);
+    [self waitForExpectationsWithTimeout:10.0 handler:nil];
+
+    RLMRealm *realm = [RLMRealm realmWithConfiguration:configurations[0] error:nil];
+    CHECK_COUNT(NUMBER_OF_BIG_OBJECTS, HugeSyncObject, realm);
+
+    RLMAssertThrowsWithReason([syncManager prefetchRealmsWithConfigurations:configurations
+                                                                 priorities:@[@1]
+                                                     maxConcurrentDownloads:1
+                                                        maxOutstandingBytes:0
+                                                                   progress:nil
+                                                                 completion:^(NSDictionary *) {}],
+                              @"must match the number of configurations");
+}
+
 - (void)testAsyncOpenConnectionTimeout {
     TimeoutProxyServer *proxy = [[TimeoutProxyServer alloc] initWithPort:5678 targetPort:9090];
     NSError *error;
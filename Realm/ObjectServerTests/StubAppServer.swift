@@ -0,0 +1,377 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2022 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#if os(macOS)
+
+import Compression
+import Foundation
+import Network
+
+/// An in-process stand-in for the App Services server which listens for HTTP
+/// requests on loopback.
+///
+/// This implements just enough of the server for benchmarking the client's
+/// networking: anonymous login, user profiles, function calls, the mongo
+/// `find`, `findOne`, `count`, `insertOne`, `insertMany` and `aggregate`
+/// functions, and the server-sent event stream used by `watch()`. Request
+/// bodies sent with a `Content-Encoding` of `gzip` are decompressed. Documents
+/// are stored in memory, queries and pipelines are ignored, and every call
+/// succeeds.
+@available(OSX 10.14, *)
+@objc(StubAppServer)
+public class StubAppServer: NSObject {
+    @objc public let appId = "stub-app"
+    @objc public private(set) var port: UInt16 = 0
+    @objc public var url: String {
+        "http://localhost:\(port)"
+    }
+
+    /// The number of bytes read from and written to the server's connections.
+    @objc public var bytesReceived: Int {
+        queue.sync { _bytesReceived }
+    }
+    @objc public var bytesSent: Int {
+        queue.sync { _bytesSent }
+    }
+    /// The number of function calls, including mongo requests, which have been received.
+    @objc public var functionCallCount: Int {
+        queue.sync { _functionCallCount }
+    }
+    /// The number of requests received with a gzip-compressed body.
+    @objc public var compressedRequestCount: Int {
+        queue.sync { _compressedRequestCount }
+    }
+
+    // These are only accessed on `queue`
+    private var _bytesReceived = 0
+    private var _bytesSent = 0
+    private var _functionCallCount = 0
+    private var _compressedRequestCount = 0
+    private var _loginCount = 0
+
+    private let queue = DispatchQueue(label: "StubAppServer")
+    private var listener: NWListener?
+    private var connections = [NWConnection]()
+    private var watchStreams = [NWConnection]()
+    private var collections = [String: [Any]]()
+
+    @objc public func start() throws {
+        let parameters = NWParameters.tcp
+        parameters.requiredInterfaceType = .loopback
+        let listener = try NWListener(using: parameters, on: .any)
+        let ready = DispatchSemaphore(value: 0)
+        listener.stateUpdateHandler = { state in
+            switch state {
+            case .ready, .failed, .cancelled:
+                ready.signal()
+            default:
+                break
+            }
+        }
+        listener.newConnectionHandler = { [unowned self] connection in
+            self.connections.append(connection)
+            connection.start(queue: self.queue)
+            self.receive(on: connection, buffer: Data())
+        }
+        listener.start(queue: queue)
+        ready.wait()
+        guard let port = listener.port else {
+            throw NSError(domain: "StubAppServer", code: 1,
+                          userInfo: [NSLocalizedDescriptionKey: "Failed to listen on loopback"])
+        }
+        self.listener = listener
+        self.port = port.rawValue
+    }
+
+    @objc public func stop() {
+        queue.sync {
+            listener?.cancel()
+            listener = nil
+            for connection in connections {
+                connection.forceCancel()
+            }
+            connections.removeAll()
+            watchStreams.removeAll()
+            collections.removeAll()
+        }
+    }
+
+    /// The number of watch streams which have been opened by clients.
+    @objc public var watchStreamCount: Int {
+        queue.sync { watchStreams.count }
+    }
+
+    /// Sends a change event to every open watch stream.
+    @objc public func sendChangeEvent(_ event: [String: Any]) {
+        let data = "data: ".data(using: .utf8)! + serialize(event) + "\n\n".data(using: .utf8)!
+        queue.async { [self] in
+            for connection in watchStreams {
+                send(data, on: connection)
+            }
+        }
+    }
+
+    // MARK: HTTP
+
+    private struct Request {
+        var method: String
+        var path: String
+        var body: Data
+        var compressed: Bool
+
+        // Removes a complete request from the front of the buffer, or returns
+        // nil if the buffer does not contain a full request yet
+        init?(parsing buffer: inout Data) {
+            guard let headerEnd = buffer.range(of: Data("\r\n\r\n".utf8)),
+                  let header = String(data: buffer[buffer.startIndex..<headerEnd.lowerBound], encoding: .utf8) else {
+                return nil
+            }
+            let lines = header.components(separatedBy: "\r\n")
+            let requestLine = lines[0].split(separator: " ")
+            guard requestLine.count >= 2 else {
+                return nil
+            }
+            var contentLength = 0
+            var compressed = false
+            for line in lines.dropFirst() {
+                let parts = line.split(separator: ":", maxSplits: 1)
+                guard parts.count == 2 else {
+                    continue
+                }
+                let value = parts[1].trimmingCharacters(in: .whitespaces)
+                switch parts[0].lowercased() {
+                case "content-length":
+                    contentLength = Int(value) ?? 0
+                case "content-encoding":
+                    compressed = value.lowercased() == "gzip"
+                default:
+                    break
+                }
+            }
+            let bodyEnd = headerEnd.upperBound + contentLength
+            guard buffer.endIndex >= bodyEnd else {
+                return nil
+            }
+            method = String(requestLine[0])
+            path = String(requestLine[1].split(separator: "?", maxSplits: 1)[0])
+            self.compressed = compressed
+            let body = buffer.subdata(in: headerEnd.upperBound..<bodyEnd)
+            self.body = compressed ? StubAppServer.gunzip(body) ?? Data() : body
+            buffer = buffer.subdata(in: bodyEnd..<buffer.endIndex)
+        }
+    }
+
+    // Decompresses a gzip member. The Compression framework only handles the
+    // raw deflate stream, so the gzip header and trailer are skipped here.
+    private static func gunzip(_ data: Data) -> Data? {
+        let bytes = [UInt8](data)
+        guard bytes.count >= 18, bytes[0] == 0x1f, bytes[1] == 0x8b, bytes[2] == 8 else {
+            return nil
+        }
+        let flags = bytes[3]
+        var offset = 10
+        if flags & 0x04 != 0 { // FEXTRA
+            guard offset + 2 <= bytes.count else { return nil }
+            offset += 2 + Int(bytes[offset]) + Int(bytes[offset + 1]) << 8
+        }
+        for flag: UInt8 in [0x08, 0x10] where flags & flag != 0 { // FNAME, FCOMMENT
+            while offset < bytes.count && bytes[offset] != 0 {
+                offset += 1
+            }
+            offset += 1
+        }
+        if flags & 0x02 != 0 { // FHCRC
+            offset += 2
+        }
+        guard offset <= bytes.count - 8 else {
+            return nil
+        }
+        // The trailer ends with the size of the uncompressed data
+        let size = bytes[(bytes.count - 4)...].reversed().reduce(0) { $0 << 8 | Int($1) }
+        if size == 0 {
+            return Data()
+        }
+        var output = [UInt8](repeating: 0, count: size)
+        let deflated = Array(bytes[offset..<(bytes.count - 8)])
+        let written = compression_decode_buffer(&output, size, deflated, deflated.count, nil, COMPRESSION_ZLIB)
+        return written == size ? Data(output) : nil
+    }
+
+    private func receive(on connection: NWConnection, buffer: Data) {
+        connection.receive(minimumIncompleteLength: 1, maximumLength: 65536) { [weak self] data, _, isComplete, error in
+            guard let self = self else {
+                return
+            }
+            var buffer = buffer
+            if let data = data {
+                self._bytesReceived += data.count
+                buffer.append(data)
+            }
+            while let request = Request(parsing: &buffer) {
+                self.handle(request, on: connection)
+            }
+            if isComplete || error != nil {
+                connection.cancel()
+                return
+            }
+            self.receive(on: connection, buffer: buffer)
+        }
+    }
+
+    private func send(_ data: Data, on connection: NWConnection) {
+        _bytesSent += data.count
+        connection.send(content: data, completion: .contentProcessed({ _ in }))
+    }
+
+    private func respond(on connection: NWConnection, status: Int = 200, json: Any) {
+        let body = serialize(json)
+        let header = "HTTP/1.1 \(status) \(status == 200 ? "OK" : "Not Found")\r\n" +
+            "Content-Type: application/json\r\n" +
+            "Content-Length: \(body.count)\r\n" +
+            "Connection: keep-alive\r\n\r\n"
+        send(Data(header.utf8) + body, on: connection)
+    }
+
+    private func handle(_ request: Request, on connection: NWConnection) {
+        let path = request.path
+        if request.compressed {
+            _compressedRequestCount += 1
+        }
+        if path.hasSuffix("/location") {
+            respond(on: connection, json: [
+                "deployment_model": "GLOBAL",
+                "location": "US-VA",
+                "hostname": url,
+                "ws_hostname": "ws://localhost:\(port)"
+            ])
+        } else if path.hasSuffix("/login") {
+            // Each login is a different user
+            _loginCount += 1
+            respond(on: connection, json: [
+                "access_token": token(),
+                "refresh_token": token(),
+                "user_id": "stub-user-\(_loginCount)",
+                "device_id": "stub-device"
+            ])
+        } else if path.hasSuffix("/auth/profile") {
+            respond(on: connection, json: [
+                "user_id": "stub-user",
+                "identities": [["id": "stub-identity", "provider_type": "anon-user"]],
+                "data": [String: Any](),
+                "type": "normal"
+            ] as [String: Any])
+        } else if path.hasSuffix("/auth/session") {
+            respond(on: connection, json: request.method == "POST" ? ["access_token": token()] : [:])
+        } else if path.hasSuffix("/functions/call") && request.method == "GET" {
+            // Watch streams are left open until the server is stopped
+            watchStreams.append(connection)
+            let header = "HTTP/1.1 200 OK\r\n" +
+                "Content-Type: text/event-stream\r\n" +
+                "Cache-Control: no-cache\r\n\r\n"
+            send(Data(header.utf8), on: connection)
+        } else if path.hasSuffix("/functions/call") {
+            _functionCallCount += 1
+            respond(on: connection, json: callFunction(request.body))
+        } else {
+            respond(on: connection, status: 404, json: ["error": "unknown route \(path)"])
+        }
+    }
+
+    // MARK: Functions
+
+    private func callFunction(_ body: Data) -> Any {
+        guard let call = (try? JSONSerialization.jsonObject(with: body)) as? [String: Any],
+              let name = call["name"] as? String else {
+            return NSNull()
+        }
+        let arguments = call["arguments"] as? [Any] ?? []
+        guard call["service"] != nil, let args = arguments.first as? [String: Any],
+              let database = args["database"] as? String,
+              let collection = args["collection"] as? String else {
+            // Plain functions echo their first argument
+            return arguments.first ?? NSNull()
+        }
+
+        let key = "\(database).\(collection)"
+        var documents = collections[key] ?? []
+        defer { collections[key] = documents }
+
+        func insert(_ document: Any) -> Any {
+            var document = document as? [String: Any] ?? [:]
+            if document["_id"] == nil {
+                document["_id"] = ["$oid": objectId()]
+            }
+            documents.append(document)
+            return document["_id"]!
+        }
+
+        switch name {
+        case "insertOne":
+            return ["insertedId": insert(args["document"] ?? [:])]
+        case "insertMany":
+            return ["insertedIds": (args["documents"] as? [Any] ?? []).map(insert)]
+        case "find":
+            if let limit = args["limit"] as? Int, limit > 0 {
+                return Array(documents.prefix(limit))
+            }
+            return documents
+        case "findOne":
+            return documents.first ?? NSNull()
+        case "count":
+            return documents.count
+        case "aggregate":
+            return documents
+        default:
+            return NSNull()
+        }
+    }
+
+    // MARK: Helpers
+
+    private var nextObjectId = 0
+    private func objectId() -> String {
+        nextObjectId += 1
+        return String(format: "%024x", nextObjectId)
+    }
+
+    // Serializes any JSON value, including the scalar values which
+    // JSONSerialization does not accept at the top level
+    private func serialize(_ value: Any) -> Data {
+        if value is [Any] || value is [String: Any] {
+            return try! JSONSerialization.data(withJSONObject: value)
+        }
+        let wrapped = try! JSONSerialization.data(withJSONObject: [value])
+        return wrapped.subdata(in: 1..<wrapped.count - 1)
+    }
+
+    // An unsigned JWT which doesn't expire for an hour
+    private func token() -> String {
+        func encode(_ value: [String: Any]) -> String {
+            serialize(value).base64EncodedString()
+                .replacingOccurrences(of: "=", with: "")
+                .replacingOccurrences(of: "+", with: "-")
+                .replacingOccurrences(of: "/", with: "_")
+        }
+        let now = Int(Date().timeIntervalSince1970)
+        return encode(["alg": "HS256", "typ": "JWT"]) + "." +
+            encode(["sub": "stub-user", "iat": now, "exp": now + 3600, "user_data": [String: Any]()]) +
+            ".c3R1Yg"
+    }
+}
+
+#endif // os(macOS)
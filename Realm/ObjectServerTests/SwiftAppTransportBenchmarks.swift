@@ -0,0 +1,300 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2022 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#if os(macOS)
+
+import Realm
+import Realm.Private
+import RealmSwift
+import XCTest
+
+#if canImport(RealmTestSupport)
+import RealmSwiftSyncTestSupport
+import RealmSyncTestSupport
+import RealmTestSupport
+#endif
+
+// Benchmarks for the app networking stack which run against StubAppServer
+// rather than a real server, so that they do not need network access. Each
+// benchmark prints the request rate, latency percentiles and the number of
+// bytes sent and received per operation.
+@available(OSX 10.14, *)
+class SwiftAppTransportBenchmarks: XCTestCase {
+    var server: StubAppServer!
+    var transport: RLMNetworkTransport!
+    var app: App!
+    var user: User!
+    var collection: MongoCollection!
+
+    override func setUp() {
+        super.setUp()
+        server = StubAppServer()
+        try! server.start()
+
+        transport = RLMNetworkTransport()
+        let config = AppConfiguration(baseURL: server.url, transport: transport,
+                                      localAppName: nil, localAppVersion: nil)
+        let rootDirectory = URL(fileURLWithPath: NSTemporaryDirectory())
+            .appendingPathComponent("app-transport-benchmarks-\(UUID().uuidString)")
+        app = App(id: server.appId, configuration: config, rootDirectory: rootDirectory)
+
+        let ex = expectation(description: "log in")
+        app.login(credentials: .anonymous) { result in
+            self.user = try! result.get()
+            ex.fulfill()
+        }
+        wait(for: [ex], timeout: 10)
+        collection = user.mongoClient("mongodb1").database(named: "benchmarks").collection(withName: "Dog")
+    }
+
+    override func tearDown() {
+        collection = nil
+        user = nil
+        app = nil
+        RLMApp.resetAppCache()
+        server.stop()
+        server = nil
+        super.tearDown()
+    }
+
+    // Runs `operation` `rounds` times with `concurrency` concurrent calls per
+    // round. The operation must call its argument once it has completed.
+    func benchmark(_ name: String, rounds: Int = 100, concurrency: Int = 1,
+                   _ operation: @escaping (@escaping () -> Void) -> Void) {
+        let lock = NSLock()
+        var latencies = [Double]()
+        latencies.reserveCapacity(rounds * concurrency)
+        let bytesSent = transport.bytesSent
+        let bytesReceived = transport.bytesReceived
+
+        let start = DispatchTime.now().uptimeNanoseconds
+        for _ in 0..<rounds {
+            let group = DispatchGroup()
+            for _ in 0..<concurrency {
+                group.enter()
+                let operationStart = DispatchTime.now().uptimeNanoseconds
+                operation {
+                    let latency = Double(DispatchTime.now().uptimeNanoseconds - operationStart) / 1e6
+                    lock.lock()
+                    latencies.append(latency)
+                    lock.unlock()
+                    group.leave()
+                }
+            }
+            XCTAssertEqual(group.wait(timeout: .now() + 10), .success)
+        }
+        let elapsed = Double(DispatchTime.now().uptimeNanoseconds - start) / 1e9
+
+        latencies.sort()
+        let count = latencies.count
+        print(String(format: "%@: %.0f requests/s, p50 %.3fms, p99 %.3fms, %llu bytes sent and %llu bytes received per request",
+                     name, Double(count) / elapsed, latencies[count / 2], latencies[count * 99 / 100],
+                     (transport.bytesSent - bytesSent) / UInt64(count),
+                     (transport.bytesReceived - bytesReceived) / UInt64(count)))
+    }
+
+    func document(_ i: Int) -> Document {
+        ["name": .string("fido \(i)"), "breed": .string("cane corso"), "age": .int64(Int64(i))]
+    }
+
+    func populate(_ count: Int) {
+        let ex = expectation(description: "insert")
+        collection.insertMany((0..<count).map(document)) { result in
+            XCTAssertEqual(try! result.get().count, count)
+            ex.fulfill()
+        }
+        wait(for: [ex], timeout: 10)
+    }
+
+    func testInsertOne() {
+        benchmark("insertOne") { done in
+            self.collection.insertOne(self.document(0)) { result in
+                XCTAssertNotNil(try? result.get())
+                done()
+            }
+        }
+    }
+
+    func testInsertMany() {
+        let documents = (0..<100).map(document)
+        benchmark("insertMany (100 documents)") { done in
+            self.collection.insertMany(documents) { result in
+                XCTAssertEqual(try? result.get().count, 100)
+                done()
+            }
+        }
+    }
+
+    func testCompressedInsertMany() {
+        transport.requestCompressionThreshold = 1024
+        let documents = (0..<100).map(document)
+        benchmark("insertMany (100 documents, compressed)") { done in
+            self.collection.insertMany(documents) { result in
+                XCTAssertEqual(try? result.get().count, 100)
+                done()
+            }
+        }
+        XCTAssertEqual(server.compressedRequestCount, 100)
+    }
+
+    func testFind() {
+        populate(1000)
+        benchmark("find (1000 documents)") { done in
+            self.collection.find(filter: [:]) { result in
+                XCTAssertEqual(try? result.get().count, 1000)
+                done()
+            }
+        }
+    }
+
+    func testAggregate() {
+        populate(1000)
+        benchmark("aggregate (1000 documents)") { done in
+            self.collection.aggregate(pipeline: [["$match": .document([:])]]) { result in
+                XCTAssertEqual(try? result.get().count, 1000)
+                done()
+            }
+        }
+    }
+
+    func testConcurrentFunctionCalls() {
+        benchmark("function calls (20 concurrent)", rounds: 20, concurrency: 20) { done in
+            self.user.__callFunctionNamed("echo", arguments: [1 as NSNumber]) { _, error in
+                XCTAssertNil(error)
+                done()
+            }
+        }
+    }
+
+    func testCoalescedFunctionCalls() {
+        app.coalescesIdenticalRequests = true
+        benchmark("function calls (20 concurrent, coalesced)", rounds: 20, concurrency: 20) { done in
+            self.user.__callFunctionNamed("echo", arguments: [1 as NSNumber]) { result, error in
+                XCTAssertNil(error)
+                XCTAssertEqual(result as? NSNumber, 1)
+                done()
+            }
+        }
+        XCTAssertLessThan(server.functionCallCount, 20 * 20)
+    }
+
+    func testCachedFind() {
+        populate(1000)
+        app.responseCacheTimeout = 60
+        let callCount = server.functionCallCount
+        benchmark("find (1000 documents, cached)") { done in
+            self.collection.find(filter: [:]) { result in
+                XCTAssertEqual(try? result.get().count, 1000)
+                done()
+            }
+        }
+        XCTAssertEqual(server.functionCallCount, callCount + 1)
+
+        app.invalidateResponseCache()
+        let ex = expectation(description: "find")
+        collection.find(filter: [:]) { result in
+            XCTAssertEqual(try? result.get().count, 1000)
+            ex.fulfill()
+        }
+        wait(for: [ex], timeout: 10)
+        XCTAssertEqual(server.functionCallCount, callCount + 2)
+    }
+
+    func testCachedResponsesAreNotSharedBetweenUsers() {
+        app.responseCacheTimeout = 60
+        func call(_ user: User) {
+            let ex = expectation(description: "call")
+            user.__callFunctionNamed("echo", arguments: [1 as NSNumber]) { result, error in
+                XCTAssertNil(error)
+                XCTAssertEqual(result as? NSNumber, 1)
+                ex.fulfill()
+            }
+            wait(for: [ex], timeout: 10)
+        }
+
+        let ex = expectation(description: "log in")
+        var otherUser: User!
+        app.login(credentials: .emailPassword(email: "other@example.com", password: "password")) { result in
+            otherUser = try! result.get()
+            ex.fulfill()
+        }
+        wait(for: [ex], timeout: 10)
+        XCTAssertNotEqual(otherUser.id, user.id)
+
+        let callCount = server.functionCallCount
+        call(user)
+        call(otherUser)
+        XCTAssertEqual(server.functionCallCount, callCount + 2)
+        call(user)
+        call(otherUser)
+        XCTAssertEqual(server.functionCallCount, callCount + 2)
+    }
+
+    class CountingDelegate: ChangeEventDelegate {
+        let expected: Int
+        let opened: XCTestExpectation
+        let received: XCTestExpectation
+        var count = 0
+
+        init(expected: Int, opened: XCTestExpectation, received: XCTestExpectation) {
+            self.expected = expected
+            self.opened = opened
+            self.received = received
+        }
+
+        func changeStreamDidOpen(_ changeStream: ChangeStream) {
+            opened.fulfill()
+        }
+        func changeStreamDidClose(with error: Error?) {}
+        func changeStreamDidReceive(error: Error) {
+            XCTFail("Unexpected error: \(error)")
+        }
+        func changeStreamDidReceive(changeEvent: AnyBSON?) {
+            count += 1
+            if count == expected {
+                received.fulfill()
+            }
+        }
+    }
+
+    func testWatch() {
+        let eventCount = 10000
+        let delegate = CountingDelegate(expected: eventCount,
+                                        opened: expectation(description: "opened"),
+                                        received: expectation(description: "received events"))
+        let stream = collection.watch(delegate: delegate, queue: DispatchQueue(label: "watch"))
+        let connected = expectation(for: NSPredicate(format: "watchStreamCount > 0"),
+                                    evaluatedWith: server, handler: nil)
+        wait(for: [connected], timeout: 10)
+
+        let event: [String: Any] = [
+            "operationType": "insert",
+            "fullDocument": ["name": "fido", "breed": "cane corso"]
+        ]
+        let start = DispatchTime.now().uptimeNanoseconds
+        for _ in 0..<eventCount {
+            server.sendChangeEvent(event)
+        }
+        wait(for: [delegate.opened, delegate.received], timeout: 60)
+        let elapsed = Double(DispatchTime.now().uptimeNanoseconds - start) / 1e9
+        print(String(format: "watch: %.0f events/s", Double(eventCount) / elapsed))
+        stream.close()
+    }
+}
+
+#endif // os(macOS)
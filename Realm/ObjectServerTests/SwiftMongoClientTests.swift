@@ -126,6 +126,33 @@ class SwiftMongoClientTests: SwiftSyncTestCase {
         wait(for: [findEx1], timeout: 4.0)
     }
 
+    func testMongoInsertManyChunked() {
+        let collection = setupMongoCollection()
+        let documents: [Document] = (0..<10).map { ["name": .string("dog \($0)"), "breed": "cane corso"] }
+
+        var progress = [Int]()
+        let insertManyEx = expectation(description: "Insert many documents in chunks")
+        collection.insertMany(documents, chunkSize: 3, maxConcurrentRequests: 2, onProgress: { inserted, total in
+            XCTAssertEqual(total, 10)
+            progress.append(inserted)
+        }, { objectIds, error in
+            XCTAssertNil(error)
+            XCTAssertEqual(objectIds.map(\.count), [3, 3, 3, 1])
+            insertManyEx.fulfill()
+        })
+        wait(for: [insertManyEx], timeout: 4.0)
+        XCTAssertEqual(progress.count, 4)
+        XCTAssertEqual(progress.last, 10)
+        XCTAssertEqual(progress, progress.sorted())
+
+        let countEx = expectation(description: "Count documents")
+        collection.count(filter: [:]) { result in
+            XCTAssertEqual(try? result.get(), 10)
+            countEx.fulfill()
+        }
+        wait(for: [countEx], timeout: 4.0)
+    }
+
     func testMongoFindResultCompletion() {
         let collection = setupMongoCollection()
 
@@ -211,6 +238,55 @@ class SwiftMongoClientTests: SwiftSyncTestCase {
         wait(for: [findOneEx2], timeout: 4.0)
     }
 
+    func testMongoFindPages() {
+        let collection = setupMongoCollection()
+        let documents: [Document] = (0..<10).map { ["name": .string("dog \($0)"), "breed": "cane corso"] }
+        let insertManyEx = expectation(description: "Insert many documents")
+        collection.insertMany(documents) { result in
+            XCTAssertEqual(try? result.get().count, 10)
+            insertManyEx.fulfill()
+        }
+        wait(for: [insertManyEx], timeout: 4.0)
+
+        var pages = [[Document]]()
+        let findEx1 = expectation(description: "Find all pages")
+        collection.find(filter: ["breed": "cane corso"], pageSize: 4, onPage: { page in
+            pages.append(page)
+            return true
+        }, { error in
+            XCTAssertNil(error)
+            findEx1.fulfill()
+        })
+        wait(for: [findEx1], timeout: 4.0)
+        XCTAssertEqual(pages.map(\.count), [4, 4, 2])
+        XCTAssertEqual(Set(pages.joined().map { $0["name"]??.stringValue }).count, 10)
+
+        // Limit applies to the total, and returning false stops early
+        pages.removeAll()
+        let findEx2 = expectation(description: "Find limited pages")
+        collection.find(filter: [:], options: FindOptions(6, nil, nil), pageSize: 4, onPage: { page in
+            pages.append(page)
+            return true
+        }, { error in
+            XCTAssertNil(error)
+            findEx2.fulfill()
+        })
+        wait(for: [findEx2], timeout: 4.0)
+        XCTAssertEqual(pages.map(\.count), [4, 2])
+
+        pages.removeAll()
+        let findEx3 = expectation(description: "Stop after one page")
+        collection.find(filter: [:], pageSize: 4, onPage: { page in
+            pages.append(page)
+            return false
+        }, { error in
+            XCTAssertNil(error)
+            findEx3.fulfill()
+        })
+        wait(for: [findEx3], timeout: 4.0)
+        XCTAssertEqual(pages.count, 1)
+    }
+
     func testMongoFindAndReplaceResultCompletion() {
         let collection = setupMongoCollection()
         let document: Document = ["name": "fido", "breed": "cane corso"]
@@ -606,6 +606,42 @@ class SwiftObjectServerTests: SwiftSyncTestCase {
         }
     }
 
+    func testAsyncOpenThrottledProgress() {
+        do {
+            let user = try logInUser(for: basicCredentials())
+            if !isParent {
+                populateRealm(user: user, partitionValue: #function)
+                return
+            }
+
+            // Wait for the child process to upload everything.
+            executeChild()
+            let ex1 = expectation(description: "async open")
+            let ex2 = expectation(description: "download progress")
+            let config = user.configuration(testName: #function)
+            let task = Realm.asyncOpen(configuration: config) { result in
+                XCTAssertNotNil(try? result.get())
+                ex1.fulfill()
+            }
+
+            var lastDelivery: Date?
+            task.addProgressNotification(minimumInterval: 0.1) { progress in
+                let now = Date()
+                if let lastDelivery = lastDelivery, !progress.isTransferComplete {
+                    XCTAssertGreaterThanOrEqual(now.timeIntervalSince(lastDelivery), 0.09)
+                }
+                lastDelivery = now
+                if progress.isTransferComplete {
+                    ex2.fulfill()
+                }
+            }
+
+            waitForExpectations(timeout: 10.0, handler: nil)
+        } catch {
+            XCTFail("Got an error: \(error) (process: \(isParent ? "parent" : "child"))")
+        }
+    }
+
     func testAsyncOpenTimeout() {
         let proxy = TimeoutProxyServer(port: 5678, targetPort: 9090)
         try! proxy.start()
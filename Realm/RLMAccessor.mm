@@ -20,6 +20,7 @@
 
 #import "RLMArray_Private.hpp"
 #import "RLMDictionary_Private.hpp"
+#import "RLMMigration_Private.h"
 #import "RLMObjectId_Private.hpp"
 #import "RLMObjectSchema_Private.hpp"
 #import "RLMObjectStore.h"
@@ -91,19 +92,59 @@ bool isNull(realm::UUID const&) {
     return false;
 }
 
+// Defined after the specializations of RLMStatelessAccessorContext::unbox()
+template<typename T>
+T unboxLazyMigratedValue(__unsafe_unretained id const value);
+
+// Objects in frozen Realms can be read from any thread and can never be
+// modified or deleted, so reading them only has to check that the Realm hasn't
+// been invalidated. Frozen and live objects share an accessor class, so this
+// is checked with the flag cached on the class info.
+void verifyAttached(__unsafe_unretained RLMObjectBase *const obj) {
+    if (obj->_info->frozen) {
+        if (REALM_UNLIKELY(!obj->_row.is_valid())) {
+            @throw RLMException(@"Object has been deleted or invalidated.");
+        }
+    }
+    else {
+        RLMVerifyAttached(obj);
+    }
+}
+
+// The class info's flat table of column keys is kept current by the binding
+// context and migrations, so this avoids going through the object schema's
+// property array
+ColKey columnKey(RLMClassInfo const& info, NSUInteger index) {
+    return info.columnKeys[index];
+}
+
 template<typename T>
 T get(__unsafe_unretained RLMObjectBase *const obj, NSUInteger index) {
-    RLMVerifyAttached(obj);
-    return obj->_row.get<T>(getProperty(obj, index).column_key);
+    verifyAttached(obj);
+    RLMClassInfo& info = *obj->_info;
+    if (REALM_UNLIKELY(info.lazyMigration)) {
+        if (auto value = RLMLazyMigratedValue(obj, index)) {
+            return unboxLazyMigratedValue<T>(*value);
+        }
+    }
+    return obj->_row.get<T>(columnKey(info, index));
 }
 
 template<typename T>
 id getBoxed(__unsafe_unretained RLMObjectBase *const obj, NSUInteger index) {
-    RLMVerifyAttached(obj);
-    auto& prop = getProperty(obj, index);
-    RLMAccessorContext ctx(obj, &prop);
-    auto value = obj->_row.get<T>(prop.column_key);
-    return isNull(value) ? nil : ctx.box(std::move(value));
+    verifyAttached(obj);
+    RLMClassInfo& info = *obj->_info;
+    if (REALM_UNLIKELY(info.lazyMigration)) {
+        if (auto value = RLMLazyMigratedValue(obj, index)) {
+            return RLMCoerceToNil(*value);
+        }
+    }
+    auto value = obj->_row.get<T>(columnKey(info, index));
+    if (isNull(value)) {
+        return nil;
+    }
+    RLMAccessorContext ctx(obj, &getProperty(obj, index));
+    return ctx.box(std::move(value));
 }
 
 template<typename T>
@@ -389,6 +430,9 @@ static realm::ColKey willChange(RLMObservationTracker& tracker,
     if (prop.is_primary) {
         @throw RLMException(@"Primary key can't be changed after an object is inserted.");
     }
+    if (REALM_UNLIKELY(obj->_info->lazyMigration)) {
+        RLMVerifyNotPendingLazyMigration(obj, index);
+    }
     tracker.willChange(RLMGetObservationInfo(obj->_observationInfo, obj->_row.get_key(), *obj->_info),
                        obj->_objectSchema.properties[index].name);
     return prop.column_key;
@@ -677,6 +721,9 @@ void RLMDynamicValidatedSet(RLMObjectBase *obj, NSString *propName, id val) {
     if (prop.isPrimary) {
         @throw RLMException(@"Primary key can't be changed to '%@' after an object is inserted.", val);
     }
+    if (REALM_UNLIKELY(obj->_info->lazyMigration)) {
+        RLMVerifyNotPendingLazyMigration(obj, prop.index);
+    }
 
     // Because embedded objects cannot be created directly, we accept anything
     // that can be converted to an embedded object for dynamic link set operations.
@@ -705,6 +752,12 @@ id RLMDynamicGet(__unsafe_unretained RLMObjectBase *const obj, __unsafe_unretain
         return [obj valueForKey:prop.name];
     }
 
+    if (REALM_UNLIKELY(obj->_info->lazyMigration) && !prop.linkOriginPropertyName) {
+        if (auto value = RLMLazyMigratedValue(obj, prop.index)) {
+            return RLMCoerceToNil(*value);
+        }
+    }
+
     realm::Object o(obj->_realm->_realm, *obj->_info->objectSchema, obj->_row);
     RLMAccessorContext c(obj);
     c.currentProperty = prop;
@@ -723,6 +776,55 @@ id RLMDynamicGetByName(__unsafe_unretained RLMObjectBase *const obj,
     return RLMDynamicGet(obj, prop);
 }
 
+id RLMDynamicGetByLinkPath(__unsafe_unretained RLMObjectBase *const obj,
+                           __unsafe_unretained NSString *const linkPath) {
+    RLMVerifyAttached(obj);
+    NSArray<NSString *> *names = [linkPath componentsSeparatedByString:@"."];
+    NSUInteger last = names.count - 1;
+    if (last == 0) {
+        return RLMDynamicGetByName(obj, linkPath);
+    }
+
+    RLMClassInfo *info = obj->_info;
+    realm::Obj row = obj->_row;
+    auto propertyForName = [&](NSString *name) {
+        RLMProperty *prop = info->rlmObjectSchema[name];
+        if (!prop) {
+            @throw RLMException(@"Invalid property name '%@' for class '%@'.",
+                                name, info->rlmObjectSchema.className);
+        }
+        return prop;
+    };
+
+    return RLMTranslateError([&]() -> id {
+        // Follow the links without creating an accessor for each object along
+        // the way, so that only the final value is boxed
+        for (NSUInteger i = 0; i < last; ++i) {
+            RLMProperty *prop = propertyForName(names[i]);
+            if (prop.type != RLMPropertyTypeObject || prop.collection) {
+                @throw RLMException(@"Property '%@' of '%@' in link path '%@' must be a link to a single object.",
+                                    prop.name, info->rlmObjectSchema.className, linkPath);
+            }
+            row = row.get_linked_object(info->columnKeys[prop.index]);
+            if (!row) {
+                return nil;
+            }
+            info = &info->linkTargetType(prop.index);
+        }
+
+        RLMProperty *prop = propertyForName(names[last]);
+        if (prop.collection || prop.type == RLMPropertyTypeLinkingObjects
+            || prop.type == RLMPropertyTypeAny || info->lazyMigration) {
+            // These need an accessor for the object which owns the property
+            return RLMDynamicGet(RLMCreateObjectAccessor(*info, std::move(row)), prop);
+        }
+        realm::Object o(info->realm->_realm, *info->objectSchema, row);
+        RLMAccessorContext c(*info);
+        c.currentProperty = prop;
+        return RLMCoerceToNil(o.get_property_value<id>(c, info->objectSchema->persisted_properties[prop.index]));
+    });
+}
+
 #pragma mark - Swift property getters and setter
 
 #define REALM_SWIFT_PROPERTY_ACCESSOR(objc, swift, rlmtype) \
@@ -1019,6 +1121,13 @@ realm::util::Optional<realm::UUID> RLMStatelessAccessorContext::unbox(__unsafe_u
     return toOptional<realm::UUID>(v);
 }
 
+namespace {
+template<typename T>
+T unboxLazyMigratedValue(__unsafe_unretained id const value) {
+    return RLMStatelessAccessorContext::unbox<T>(value);
+}
+} // anonymous namespace
+
 std::pair<realm::Obj, bool>
 RLMAccessorContext::createObject(id value, realm::CreatePolicy policy,
                                  bool forceCreate, ObjKey existingKey) {
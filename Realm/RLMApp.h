@@ -154,6 +154,40 @@ Create a new Realm App configuration.
 - (RLMPushClient *)pushClientWithServiceName:(NSString *)serviceName
     NS_SWIFT_NAME(pushClient(serviceName:));
 
+/**
+ Whether identical requests which are in flight at the same time should share
+ a single network call.
+
+ When enabled, calls to `-[RLMUser callFunctionNamed:arguments:completionBlock:]`
+ and `-[RLMMongoCollection findWhere:options:completion:]` made by the same user
+ with the same function or collection and the same arguments while an earlier
+ identical call has not yet completed are not sent to the server. Instead, they
+ receive the result of the earlier call. Defaults to `NO`.
+ */
+@property (nonatomic) BOOL coalescesIdenticalRequests;
+
+/**
+ The number of seconds for which the results of successful function calls and
+ `find` requests are cached and reused for identical requests.
+
+ Cached responses are returned without contacting the server, so this should
+ only be used for requests whose results can be stale for this long. Use
+ `invalidateResponseCache` to discard cached responses after performing a
+ write. Cached responses are still delivered asynchronously on a background
+ queue. At most 128 responses are cached, and the one which expires soonest is
+ discarded to make room for a new one. Defaults to `0`, which disables the
+ cache.
+ */
+@property (nonatomic) NSTimeInterval responseCacheTimeout;
+
+/**
+ Discards all cached responses.
+
+ Requests which are in flight when this is called are not shared with requests
+ made after it, and their results are not cached.
+ */
+- (void)invalidateResponseCache;
+
 /**
  RLMApp instances are cached internally by Realm and cannot be created directly.
 
@@ -21,6 +21,7 @@
 #import "RLMBSON_Private.hpp"
 #import "RLMCredentials_Private.hpp"
 #import "RLMEmailPasswordAuth.h"
+#import "RLMNetworkTransport_Private.hpp"
 #import "RLMPushClient_Private.hpp"
 #import "RLMSyncManager_Private.hpp"
 #import "RLMUser_Private.hpp"
@@ -69,7 +70,7 @@ namespace {
                     .http_status_code = static_cast<int>(response.httpStatusCode),
                     .custom_status_code = static_cast<int>(response.customStatusCode),
                     .headers = bridgingHeaders,
-                    .body = response.body ? response.body.UTF8String : ""
+                    .body = RLMResponseTakeBody(response)
                 });
             }];
         }
@@ -82,6 +83,96 @@ namespace {
     };
 }
 
+#pragma mark RLMAppResponseCache
+
+void RLMAppResponseCache::perform(std::function<std::string()> const& make_key, Callback callback,
+                                  std::function<void(Callback)> const& send) {
+    bool coalesce = coalesce_requests;
+    double ttl = time_to_live;
+    if (!coalesce && ttl <= 0) {
+        return send(std::move(callback));
+    }
+
+    std::string key = make_key();
+    Waiters waiters;
+    uint64_t generation;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (ttl > 0) {
+            if (auto it = m_cache.find(key); it != m_cache.end()) {
+                if (it->second.expires > std::chrono::steady_clock::now()) {
+                    auto value = it->second.value;
+                    lock.unlock();
+                    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+                        callback(util::none, value);
+                    });
+                    return;
+                }
+                m_cache.erase(it);
+            }
+        }
+        if (coalesce) {
+            if (auto it = m_in_flight.find(key); it != m_in_flight.end()) {
+                it->second->push_back(std::move(callback));
+                return;
+            }
+            waiters = std::make_shared<std::vector<Callback>>();
+            m_in_flight[key] = waiters;
+        }
+        generation = m_generation;
+    }
+    if (!waiters) {
+        waiters = std::make_shared<std::vector<Callback>>();
+    }
+    waiters->push_back(std::move(callback));
+
+    send([self = shared_from_this(), key = std::move(key), waiters, generation, ttl]
+         (const util::Optional<app::AppError>& error, const util::Optional<bson::Bson>& response) {
+        std::vector<Callback> callbacks;
+        {
+            std::lock_guard<std::mutex> lock(self->m_mutex);
+            if (auto it = self->m_in_flight.find(key); it != self->m_in_flight.end() && it->second == waiters) {
+                self->m_in_flight.erase(it);
+            }
+            if (ttl > 0 && !error && response && generation == self->m_generation) {
+                auto now = std::chrono::steady_clock::now();
+                for (auto it = self->m_cache.begin(); it != self->m_cache.end();) {
+                    it = it->second.expires > now ? std::next(it) : self->m_cache.erase(it);
+                }
+                size_t max_entries = self->max_entries;
+                self->m_cache.erase(key);
+                while (!self->m_cache.empty() && self->m_cache.size() >= max_entries) {
+                    self->m_cache.erase(std::min_element(self->m_cache.begin(), self->m_cache.end(),
+                                                         [](auto& a, auto& b) {
+                        return a.second.expires < b.second.expires;
+                    }));
+                }
+                auto expires = now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::duration<double>(ttl));
+                if (max_entries > 0) {
+                    self->m_cache.emplace(key, Entry{expires, *response});
+                }
+            }
+            callbacks.swap(*waiters);
+        }
+        for (auto& callback : callbacks) {
+            callback(error, response);
+        }
+    });
+}
+
+void RLMAppResponseCache::invalidate() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_generation;
+    m_in_flight.clear();
+    m_cache.clear();
+}
+
+size_t RLMAppResponseCache::cached_response_count() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_cache.size();
+}
+
 #pragma mark RLMAppConfiguration
 @implementation RLMAppConfiguration {
     realm::app::App::Config _config;
@@ -234,6 +325,7 @@ NSError *RLMAppErrorToNSError(realm::app::AppError const& appError) {
 #pragma mark RLMApp
 @interface RLMApp() <ASAuthorizationControllerDelegate> {
     std::shared_ptr<realm::app::App> _app;
+    std::shared_ptr<RLMAppResponseCache> _responseCache;
     __weak id<RLMASLoginDelegate> _authorizationDelegate API_AVAILABLE(ios(13.0), macos(10.15), tvos(13.0), watchos(6.0));
 }
 
@@ -245,6 +337,7 @@ NSError *RLMAppErrorToNSError(realm::app::AppError const& appError) {
     if (self = [super init]) {
         _configuration = [[RLMAppConfiguration alloc] initWithConfig:app->config()];
         _app = app;
+        _responseCache = std::make_shared<RLMAppResponseCache>();
         _syncManager = [[RLMSyncManager alloc] initWithSyncManager:_app->sync_manager()];
         return self;
     }
@@ -274,6 +367,7 @@ NSError *RLMAppErrorToNSError(realm::app::AppError const& appError) {
                                             [RLMSyncManager configurationWithRootDirectory:rootDirectory appId:appId]);
         });
 
+        _responseCache = std::make_shared<RLMAppResponseCache>();
         _syncManager = [[RLMSyncManager alloc] initWithSyncManager:_app->sync_manager()];
         return self;
     }
@@ -319,6 +413,33 @@ static std::mutex& s_appMutex = *new std::mutex();
     return _app;
 }
 
+- (std::shared_ptr<RLMAppResponseCache>)_responseCache {
+    return _responseCache;
+}
+
+- (BOOL)coalescesIdenticalRequests {
+    return _responseCache->coalesce_requests;
+}
+
+- (void)setCoalescesIdenticalRequests:(BOOL)coalescesIdenticalRequests {
+    _responseCache->coalesce_requests = coalescesIdenticalRequests;
+}
+
+- (NSTimeInterval)responseCacheTimeout {
+    return _responseCache->time_to_live;
+}
+
+- (void)setResponseCacheTimeout:(NSTimeInterval)responseCacheTimeout {
+    if (responseCacheTimeout < 0) {
+        @throw RLMException(@"Response cache timeout must be non-negative, but was %f", responseCacheTimeout);
+    }
+    _responseCache->time_to_live = responseCacheTimeout;
+}
+
+- (void)invalidateResponseCache {
+    _responseCache->invalidate();
+}
+
 - (NSDictionary<NSString *, RLMUser *> *)allUsers {
     NSMutableDictionary *buffer = [NSMutableDictionary new];
     for (auto&& user : _app->sync_manager()->all_users()) {
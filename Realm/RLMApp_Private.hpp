@@ -20,10 +20,51 @@
 
 #import <realm/object-store/sync/app.hpp>
 
+#import <atomic>
+#import <chrono>
 #import <memory>
+#import <mutex>
+#import <unordered_map>
 
 NS_ASSUME_NONNULL_BEGIN
 
+/// Coalesces identical in-flight App requests and caches their responses for a
+/// short time. Both are disabled until `coalesce_requests` or `time_to_live`
+/// are set.
+class RLMAppResponseCache : public std::enable_shared_from_this<RLMAppResponseCache> {
+public:
+    using Callback = std::function<void(const realm::util::Optional<realm::app::AppError>&,
+                                        const realm::util::Optional<realm::bson::Bson>&)>;
+
+    std::atomic<bool> coalesce_requests{false};
+    std::atomic<double> time_to_live{0};
+    // The maximum number of cached responses. The response which expires
+    // soonest is evicted to make room for a new one.
+    std::atomic<size_t> max_entries{128};
+
+    // Reports a cached response to `callback` or attaches it to an identical
+    // in-flight request if possible, and otherwise calls `send` to perform
+    // the request. `make_key` is only called if either feature is enabled.
+    // Cached responses are reported asynchronously on a background queue, as
+    // responses from the server are.
+    void perform(std::function<std::string()> const& make_key, Callback callback,
+                 std::function<void(Callback)> const& send);
+    void invalidate();
+    size_t cached_response_count();
+
+private:
+    struct Entry {
+        std::chrono::steady_clock::time_point expires;
+        realm::bson::Bson value;
+    };
+    using Waiters = std::shared_ptr<std::vector<Callback>>;
+
+    std::mutex m_mutex;
+    uint64_t m_generation = 0;
+    std::unordered_map<std::string, Waiters> m_in_flight;
+    std::unordered_map<std::string, Entry> m_cache;
+};
+
 @interface RLMAppConfiguration ()
 
 - (realm::app::App::Config&)config;
@@ -37,6 +78,7 @@ NS_ASSUME_NONNULL_BEGIN
 @interface RLMApp ()
 
 - (std::shared_ptr<realm::app::App>)_realmApp;
+- (std::shared_ptr<RLMAppResponseCache>)_responseCache;
 
 + (instancetype)appWithId:(NSString *)appId
             configuration:(nullable RLMAppConfiguration *)configuration
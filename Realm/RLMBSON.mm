@@ -18,12 +18,23 @@
 
 #import "RLMBSON_Private.hpp"
 
+#import "RLMClassInfo.hpp"
 #import "RLMDecimal128_Private.hpp"
+#import "RLMMigration_Private.h"
 #import "RLMObjectId_Private.hpp"
+#import "RLMObjectSchema_Private.hpp"
+#import "RLMObjectStore.h"
+#import "RLMObject_Private.hpp"
+#import "RLMProperty_Private.h"
+#import "RLMRealm_Private.hpp"
 #import "RLMUUID_Private.hpp"
 #import "RLMUtil.hpp"
 
 #import <realm/object-store/util/bson/bson.hpp>
+#import <realm/dictionary.hpp>
+#import <realm/list.hpp>
+#import <realm/set.hpp>
+#import <realm/table.hpp>
 
 using namespace realm;
 using namespace bson;
@@ -400,3 +411,530 @@ id<RLMBSON> RLMConvertBsonToRLMBSON(const Bson& b) {
 id<RLMBSON> RLMConvertBsonDocumentToRLMBSON(realm::util::Optional<BsonDocument> b) {
     return b ? RLMConvertBsonToRLMBSON(*b) : nil;
 }
+
+#pragma mark Realm objects
+
+namespace {
+// Primitives for writing the binary BSON format. All supported platforms are
+// little-endian, which is the byte order BSON uses, so numeric values are
+// copied as-is.
+class BsonWriter {
+public:
+    BsonWriter(std::string& buffer) : m_buffer(buffer) { }
+
+protected:
+    std::string& m_buffer;
+
+    template<typename T>
+    void append(T value) {
+        m_buffer.append(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    void appendCString(const char *str) {
+        m_buffer.append(str, strlen(str) + 1);
+    }
+
+    void appendString(const char *str, size_t size) {
+        append<int32_t>(static_cast<int32_t>(size + 1));
+        m_buffer.append(str, size);
+        m_buffer.push_back('\0');
+    }
+
+    size_t beginDocument() {
+        size_t start = m_buffer.size();
+        append<int32_t>(0);
+        return start;
+    }
+
+    void endDocument(size_t start) {
+        m_buffer.push_back('\0');
+        int32_t size = static_cast<int32_t>(m_buffer.size() - start);
+        memcpy(&m_buffer[start], &size, sizeof(size));
+    }
+
+    void writeElementHeader(char type, const char *name) {
+        m_buffer.push_back(type);
+        appendCString(name);
+    }
+
+    void writeBinary(const char *name, char subtype, const char *data, size_t size) {
+        writeElementHeader(0x05, name);
+        append<int32_t>(static_cast<int32_t>(size));
+        m_buffer.push_back(subtype);
+        m_buffer.append(data, size);
+    }
+};
+
+// Writes objects directly from their columns
+class ObjectBsonWriter : public BsonWriter {
+public:
+    using BsonWriter::BsonWriter;
+
+    void writeDocument(RLMClassInfo& info, const Obj& obj, NSArray<RLMProperty *> *properties) {
+        size_t start = beginDocument();
+        // Properties which are still being lazily migrated have to be read
+        // through an accessor so that the migration block supplies the value
+        RLMObjectBase *accessor;
+        for (RLMProperty *prop in properties) {
+            if (prop.type == RLMPropertyTypeLinkingObjects) {
+                continue;
+            }
+            const char *name = prop.columnName.UTF8String;
+            auto column = info.tableColumn(prop);
+            if (prop.array || prop.set) {
+                std::unique_ptr<CollectionBase> collection;
+                if (prop.array) {
+                    collection = obj.get_listbase_ptr(column);
+                }
+                else {
+                    collection = obj.get_setbase_ptr(column);
+                }
+                writeElementHeader(0x04, name);
+                size_t arrayStart = beginDocument();
+                for (size_t i = 0, size = collection->size(); i < size; ++i) {
+                    writeValue(std::to_string(i).c_str(), collection->get_any(i), info, prop);
+                }
+                endDocument(arrayStart);
+            }
+            else if (prop.dictionary) {
+                auto dictionary = obj.get_dictionary(column);
+                writeElementHeader(0x03, name);
+                size_t dictionaryStart = beginDocument();
+                for (size_t i = 0, size = dictionary.size(); i < size; ++i) {
+                    auto [key, value] = dictionary.get_pair(i);
+                    writeValue(std::string(key.get_string()).c_str(), value, info, prop);
+                }
+                endDocument(dictionaryStart);
+            }
+            else {
+                if (REALM_UNLIKELY(info.lazyMigration)) {
+                    if (!accessor) {
+                        accessor = RLMCreateObjectAccessor(info, Obj(obj));
+                    }
+                    if (auto value = RLMLazyMigratedValue(accessor, prop.index)) {
+                        writeValue(name, RLMObjcToMixed(*value, info.realm), info, prop);
+                        continue;
+                    }
+                }
+                writeValue(name, obj.get_any(column), info, prop);
+            }
+        }
+        endDocument(start);
+    }
+
+private:
+    void writeValue(const char *name, Mixed value, RLMClassInfo& info, RLMProperty *prop) {
+        if (value.is_null()) {
+            return writeElementHeader(0x0A, name);
+        }
+        switch (value.get_type()) {
+            case type_Int:
+                writeElementHeader(0x12, name);
+                append<int64_t>(value.get_int());
+                break;
+            case type_Bool:
+                writeElementHeader(0x08, name);
+                m_buffer.push_back(value.get_bool() ? 1 : 0);
+                break;
+            case type_Float:
+                writeElementHeader(0x01, name);
+                append<double>(value.get_float());
+                break;
+            case type_Double:
+                writeElementHeader(0x01, name);
+                append<double>(value.get_double());
+                break;
+            case type_String: {
+                auto str = value.get_string();
+                writeElementHeader(0x02, name);
+                appendString(str.data(), str.size());
+                break;
+            }
+            case type_Binary: {
+                auto data = value.get_binary();
+                writeBinary(name, 0x00, data.data(), data.size());
+                break;
+            }
+            case type_Timestamp: {
+                auto ts = value.get_timestamp();
+                writeElementHeader(0x09, name);
+                append<int64_t>(ts.get_seconds() * 1000 + ts.get_nanoseconds() / 1'000'000);
+                break;
+            }
+            case type_ObjectId: {
+                auto bytes = value.get_object_id().to_bytes();
+                writeElementHeader(0x07, name);
+                m_buffer.append(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+                break;
+            }
+            case type_Decimal: {
+                auto raw = value.get_decimal().raw();
+                writeElementHeader(0x13, name);
+                append<uint64_t>(raw->w[0]);
+                append<uint64_t>(raw->w[1]);
+                break;
+            }
+            case type_UUID: {
+                auto bytes = value.get_uuid().to_bytes();
+                writeBinary(name, 0x04, reinterpret_cast<const char *>(bytes.data()), bytes.size());
+                break;
+            }
+            case type_Link: {
+                auto& target = info.linkTargetType(prop.index);
+                writeLink(name, target, target.table()->get_object(value.get<ObjKey>()));
+                break;
+            }
+            case type_TypedLink: {
+                auto link = value.get_link();
+                if (auto target = info.realm->_info[link.get_table_key()]) {
+                    writeLink(name, *target, target->table()->get_object(link.get_obj_key()));
+                }
+                else {
+                    writeElementHeader(0x0A, name);
+                }
+                break;
+            }
+            default:
+                writeElementHeader(0x0A, name);
+                break;
+        }
+    }
+
+    // Embedded objects are written as nested documents, and links to
+    // top-level objects as the target's primary key
+    void writeLink(const char *name, RLMClassInfo& target, const Obj& obj) {
+        if (target.rlmObjectSchema.isEmbedded) {
+            writeElementHeader(0x03, name);
+            writeDocument(target, obj, target.rlmObjectSchema.properties);
+        }
+        else if (RLMProperty *primaryKey = target.propertyForPrimaryKey()) {
+            writeValue(name, obj.get_any(target.tableColumn(primaryKey)), target, primaryKey);
+        }
+        else {
+            writeElementHeader(0x0A, name);
+        }
+    }
+};
+
+// Writes Bson values produced by the object store
+class BsonValueWriter : public BsonWriter {
+public:
+    using BsonWriter::BsonWriter;
+
+    void writeDocument(const BsonDocument& document) {
+        size_t start = beginDocument();
+        for (auto it = document.begin(); it != document.end(); ++it) {
+            const auto& entry = *it;
+            writeValue(entry.first.c_str(), entry.second);
+        }
+        endDocument(start);
+    }
+
+    void writeArray(const BsonArray& array) {
+        size_t start = beginDocument();
+        for (size_t i = 0; i < array.size(); ++i) {
+            writeValue(std::to_string(i).c_str(), array[i]);
+        }
+        endDocument(start);
+    }
+
+    void writeValue(const char *name, const Bson& value) {
+        switch (value.type()) {
+            case Bson::Type::Null:
+                writeElementHeader(0x0A, name);
+                break;
+            case Bson::Type::Int32:
+                writeElementHeader(0x10, name);
+                append<int32_t>(static_cast<int32_t>(value));
+                break;
+            case Bson::Type::Int64:
+                writeElementHeader(0x12, name);
+                append<int64_t>(static_cast<int64_t>(value));
+                break;
+            case Bson::Type::Bool:
+                writeElementHeader(0x08, name);
+                m_buffer.push_back(static_cast<bool>(value) ? 1 : 0);
+                break;
+            case Bson::Type::Double:
+                writeElementHeader(0x01, name);
+                append<double>(static_cast<double>(value));
+                break;
+            case Bson::Type::String: {
+                const auto& str = static_cast<const std::string&>(value);
+                writeElementHeader(0x02, name);
+                appendString(str.data(), str.size());
+                break;
+            }
+            case Bson::Type::Binary: {
+                const auto& data = static_cast<const std::vector<char>&>(value);
+                writeBinary(name, 0x00, data.data(), data.size());
+                break;
+            }
+            case Bson::Type::Timestamp: {
+                auto ts = static_cast<MongoTimestamp>(value);
+                writeElementHeader(0x11, name);
+                append<uint32_t>(static_cast<uint32_t>(ts.increment));
+                append<uint32_t>(static_cast<uint32_t>(ts.seconds));
+                break;
+            }
+            case Bson::Type::Datetime: {
+                auto ts = static_cast<Timestamp>(value);
+                writeElementHeader(0x09, name);
+                append<int64_t>(ts.get_seconds() * 1000 + ts.get_nanoseconds() / 1'000'000);
+                break;
+            }
+            case Bson::Type::ObjectId: {
+                auto bytes = static_cast<ObjectId>(value).to_bytes();
+                writeElementHeader(0x07, name);
+                m_buffer.append(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+                break;
+            }
+            case Bson::Type::Decimal128: {
+                auto decimal = static_cast<Decimal128>(value);
+                auto raw = decimal.raw();
+                writeElementHeader(0x13, name);
+                append<uint64_t>(raw->w[0]);
+                append<uint64_t>(raw->w[1]);
+                break;
+            }
+            case Bson::Type::RegularExpression: {
+                auto regex = static_cast<RegularExpression>(value);
+                using Option = RegularExpression::Option;
+                auto options = static_cast<int>(regex.options());
+                writeElementHeader(0x0B, name);
+                appendCString(regex.pattern().c_str());
+                // BSON requires the options to be in alphabetical order
+                static const std::pair<Option, char> flags[] = {
+                    {Option::IgnoreCase, 'i'}, {Option::Multiline, 'm'},
+                    {Option::Dotall, 's'}, {Option::Extended, 'x'}
+                };
+                for (auto [option, flag] : flags) {
+                    if (options & static_cast<int>(option)) {
+                        m_buffer.push_back(flag);
+                    }
+                }
+                m_buffer.push_back('\0');
+                break;
+            }
+            case Bson::Type::MaxKey:
+                writeElementHeader(0x7F, name);
+                break;
+            case Bson::Type::MinKey:
+                writeElementHeader(static_cast<char>(0xFF), name);
+                break;
+            case Bson::Type::Document:
+                writeElementHeader(0x03, name);
+                writeDocument(static_cast<const BsonDocument&>(value));
+                break;
+            case Bson::Type::Array:
+                writeElementHeader(0x04, name);
+                writeArray(static_cast<const BsonArray&>(value));
+                break;
+            case Bson::Type::Uuid: {
+                auto bytes = static_cast<realm::UUID>(value).to_bytes();
+                writeBinary(name, 0x04, reinterpret_cast<const char *>(bytes.data()), bytes.size());
+                break;
+            }
+        }
+    }
+};
+
+// Reads the binary BSON format into Bson values, validating the input as it goes
+class BsonReader {
+public:
+    BsonReader(const char *data, size_t size) : m_data(data), m_end(data + size) { }
+
+    BsonDocument readDocument() {
+        BsonDocument document;
+        readElements([&](std::string&& name, Bson&& value) {
+            document[name] = std::move(value);
+        });
+        return document;
+    }
+
+    // Arrays are encoded as documents whose keys are the element indices, so
+    // the keys are ignored and the values are read in order
+    BsonArray readArray() {
+        BsonArray array;
+        readElements([&](std::string&&, Bson&& value) {
+            array.push_back(std::move(value));
+        });
+        return array;
+    }
+
+    bool atEnd() const {
+        return m_data == m_end;
+    }
+
+private:
+    const char *m_data;
+    const char *m_end;
+
+    [[noreturn]] void fail() {
+        @throw RLMException(@"Invalid BSON data");
+    }
+
+    const char *take(size_t size) {
+        if (static_cast<size_t>(m_end - m_data) < size) {
+            fail();
+        }
+        const char *ret = m_data;
+        m_data += size;
+        return ret;
+    }
+
+    template<typename T>
+    T read() {
+        T value;
+        memcpy(&value, take(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    std::string readCString() {
+        auto end = static_cast<const char *>(memchr(m_data, '\0', m_end - m_data));
+        if (!end) {
+            fail();
+        }
+        std::string str(m_data, end);
+        m_data = end + 1;
+        return str;
+    }
+
+    std::string readString() {
+        int32_t size = read<int32_t>();
+        if (size < 1) {
+            fail();
+        }
+        const char *str = take(size);
+        if (str[size - 1] != '\0') {
+            fail();
+        }
+        return std::string(str, size - 1);
+    }
+
+    template<typename Fn>
+    void readElements(Fn&& fn) {
+        int32_t size = read<int32_t>();
+        if (size < 5) {
+            fail();
+        }
+        const char *start = m_data - sizeof(int32_t);
+        const char *end = start + size;
+        if (end > m_end || end[-1] != '\0') {
+            fail();
+        }
+        while (m_data < end - 1) {
+            char type = read<char>();
+            std::string name = readCString();
+            fn(std::move(name), readValue(type));
+        }
+        if (m_data != end - 1) {
+            fail();
+        }
+        m_data = end;
+    }
+
+    Bson readValue(char type) {
+        switch (static_cast<unsigned char>(type)) {
+            case 0x01:
+                return read<double>();
+            case 0x02:
+                return readString();
+            case 0x03:
+                return readDocument();
+            case 0x04:
+                return readArray();
+            case 0x05: {
+                int32_t size = read<int32_t>();
+                if (size < 0) {
+                    fail();
+                }
+                char subtype = read<char>();
+                const char *data = take(size);
+                if (subtype == 0x04 && size == sizeof(realm::UUID::UUIDBytes)) {
+                    realm::UUID::UUIDBytes bytes;
+                    memcpy(bytes.data(), data, bytes.size());
+                    return realm::UUID(bytes);
+                }
+                return std::vector<char>(data, data + size);
+            }
+            case 0x07: {
+                ObjectId::ObjectIdBytes bytes;
+                memcpy(bytes.data(), take(bytes.size()), bytes.size());
+                return ObjectId(bytes);
+            }
+            case 0x08:
+                return read<char>() != 0;
+            case 0x09: {
+                int64_t milliseconds = read<int64_t>();
+                return Timestamp(milliseconds / 1000, static_cast<int32_t>(milliseconds % 1000) * 1'000'000);
+            }
+            case 0x0A:
+                return util::none;
+            case 0x0B: {
+                std::string pattern = readCString();
+                return RegularExpression(pattern, readCString());
+            }
+            case 0x10:
+                return read<int32_t>();
+            case 0x11: {
+                uint32_t increment = read<uint32_t>();
+                uint32_t seconds = read<uint32_t>();
+                return MongoTimestamp(seconds, increment);
+            }
+            case 0x12:
+                return read<int64_t>();
+            case 0x13: {
+                Decimal128 value;
+                value.raw()->w[0] = read<uint64_t>();
+                value.raw()->w[1] = read<uint64_t>();
+                return value;
+            }
+            case 0x7F:
+                return max_key;
+            case 0xFF:
+                return min_key;
+            default:
+                @throw RLMException(@"Unsupported BSON type 0x%02x", static_cast<unsigned char>(type));
+        }
+    }
+};
+} // anonymous namespace
+
+void RLMAppendObjectBson(std::string& buffer, RLMClassInfo& info, const realm::Obj& obj,
+                         NSArray<RLMProperty *> *properties) {
+    ObjectBsonWriter(buffer).writeDocument(info, obj, properties ?: info.rlmObjectSchema.properties);
+}
+
+NSData *RLMDataWithBsonBuffer(std::string&& buffer) {
+    auto owned = new std::string(std::move(buffer));
+    return [[NSData alloc] initWithBytesNoCopy:owned->data() length:owned->size()
+                                   deallocator:^(void *, NSUInteger) { delete owned; }];
+}
+
+BsonArray RLMBsonArrayWithData(NSData *data) {
+    BsonReader reader(static_cast<const char *>(data.bytes), data.length);
+    auto array = reader.readArray();
+    if (!reader.atEnd()) {
+        @throw RLMException(@"Invalid BSON data");
+    }
+    return array;
+}
+
+void RLMAppendBson(std::string& buffer, const Bson& value) {
+    BsonValueWriter writer(buffer);
+    switch (value.type()) {
+        case Bson::Type::Document:
+            return writer.writeDocument(static_cast<const BsonDocument&>(value));
+        case Bson::Type::Array:
+            return writer.writeArray(static_cast<const BsonArray&>(value));
+        default:
+            @throw RLMException(@"Only documents and arrays can be encoded as binary BSON");
+    }
+}
+
+NSData *RLMFunctionResponseData(const Bson& response) {
+    std::string buffer;
+    BsonValueWriter(buffer).writeDocument(BsonDocument{{"value", response}});
+    return RLMDataWithBsonBuffer(std::move(buffer));
+}
@@ -19,14 +19,46 @@
 #import "RLMBSON.h"
 #import <realm/util/optional.hpp>
 
+#import <string>
+#import <vector>
+
+@class RLMProperty;
+class RLMClassInfo;
+
 namespace realm {
+class Obj;
 namespace bson {
 class Bson;
 template <typename> class IndexedMap;
 using BsonDocument = IndexedMap<Bson>;
+using BsonArray = std::vector<Bson>;
 }
 }
 
 realm::bson::Bson RLMConvertRLMBSONToBson(id<RLMBSON> b);
 id<RLMBSON> RLMConvertBsonToRLMBSON(const realm::bson::Bson& b);
 id<RLMBSON> RLMConvertBsonDocumentToRLMBSON(realm::util::Optional<realm::bson::BsonDocument> b);
+
+// Append the given properties of a managed object to `buffer` as a binary BSON
+// document, reading the values directly from the object's columns. All
+// properties are written if `properties` is nil. Embedded objects are written
+// as nested documents and links to other objects as their primary key.
+void RLMAppendObjectBson(std::string& buffer, RLMClassInfo& info, const realm::Obj& obj,
+                         NSArray<RLMProperty *> *properties);
+
+// Wrap an encoded buffer in an NSData which takes ownership of it rather than
+// copying it
+NSData *RLMDataWithBsonBuffer(std::string&& buffer);
+
+// Decode a binary BSON array, which is a document whose keys are the element
+// indices. Throws if the data is not valid BSON.
+realm::bson::BsonArray RLMBsonArrayWithData(NSData *data);
+
+// Append a document or array to `buffer` as a binary BSON document. Arrays
+// are written as a document keyed by the element indices. Throws for any other
+// type of value.
+void RLMAppendBson(std::string& buffer, const realm::bson::Bson& value);
+
+// Encode the response of a function call as a binary BSON document with a
+// single field named "value", whatever the type of the response.
+NSData *RLMFunctionResponseData(const realm::bson::Bson& response);
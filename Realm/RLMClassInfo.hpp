@@ -17,7 +17,9 @@
 ////////////////////////////////////////////////////////////////////////////
 
 #import <Foundation/Foundation.h>
+#import <Realm/RLMRealmConfiguration.h>
 
+#import <realm/keys.hpp>
 #import <realm/table_ref.hpp>
 #import <realm/util/optional.hpp>
 
@@ -51,6 +53,24 @@ template<> struct equal_to<NSString *> {
 };
 }
 
+// The lazy property migrations for a type which may not yet have been applied
+// to every object. Objects are stored in key order and are swept in that
+// order, so a property is pending for an object if the object's key is greater
+// than the cursor persisted for that property and no greater than the highest
+// key which existed when the migration was scheduled.
+struct RLMLazyMigrationInfo {
+    struct Property {
+        NSUInteger index;
+        NSString *name;
+        RLMLazyPropertyMigrationBlock block;
+        int64_t cursor;
+        int64_t maxKey;
+    };
+    std::vector<Property> properties;
+    // The read transaction version which the cursors were read at
+    uint_fast64_t version = -1;
+};
+
 // The per-RLMRealm object schema information which stores the cached table
 // reference, handles table column lookups, and tracks observed objects
 class RLMClassInfo {
@@ -63,11 +83,25 @@ public:
     __unsafe_unretained RLMRealm *const realm;
     __unsafe_unretained RLMObjectSchema *const rlmObjectSchema;
     const realm::ObjectSchema *const objectSchema;
+    // Whether the Realm is frozen, which is cached here as it is checked by
+    // every property getter
+    const bool frozen;
 
     // Storage for the functionality in RLMObservation for handling indirect
     // changes to KVO-observed things
     std::vector<RLMObservationInfo *> observedObjects;
 
+    // The column key for each persisted property, indexed by property index,
+    // which the getters read rather than looking up the property in the object
+    // schema. Core updates the column keys of the object schema in place when
+    // it re-reads the schema from the file, so these must be refreshed with
+    // updateColumnKeys() whenever that happens.
+    std::vector<realm::ColKey> columnKeys;
+
+    // The lazy property migrations registered for this type, or null if there
+    // are none pending
+    std::unique_ptr<RLMLazyMigrationInfo> lazyMigration;
+
     // Get the table for this object type. Will return nullptr only if it's a
     // read-only Realm that is missing the table entirely.
     realm::TableRef table() const;
@@ -92,6 +126,9 @@ public:
     // getting the opposite table column of the origin's "forward" link.
     realm::ColKey computedTableColumn(RLMProperty *property) const;
 
+    // Re-read the column keys from the object schema
+    void updateColumnKeys();
+
     // Get the info for the target of the link at the given property index.
     RLMClassInfo &linkTargetType(size_t propertyIndex);
 
@@ -129,6 +166,9 @@ public:
     // Look up by table key, return none if its not present.
     RLMClassInfo* operator[](realm::TableKey const& tableKey);
 
+    // Re-read the column keys of every type after the schema has changed
+    void updateColumnKeys();
+
     // Emplaces a locally derived object schema into RLMSchemaInfo. This is used
     // when creating objects dynamically that are not registered in the Cocoa schema.
     // Note: `RLMClassInfo` assumes ownership of `schema`.
@@ -33,16 +33,29 @@
 
 using namespace realm;
 
+static std::vector<ColKey> columnKeysForSchema(const realm::ObjectSchema& objectSchema) {
+    std::vector<ColKey> keys;
+    keys.reserve(objectSchema.persisted_properties.size());
+    for (auto& prop : objectSchema.persisted_properties) {
+        keys.push_back(prop.column_key);
+    }
+    return keys;
+}
+
 RLMClassInfo::RLMClassInfo(__unsafe_unretained RLMRealm *const realm,
                            __unsafe_unretained RLMObjectSchema *const rlmObjectSchema,
                            const realm::ObjectSchema *objectSchema)
-: realm(realm), rlmObjectSchema(rlmObjectSchema), objectSchema(objectSchema) { }
+: realm(realm), rlmObjectSchema(rlmObjectSchema), objectSchema(objectSchema)
+, frozen(realm->_realm && realm->_realm->is_frozen())
+, columnKeys(columnKeysForSchema(*objectSchema)) { }
 
 RLMClassInfo::RLMClassInfo(RLMRealm *realm, RLMObjectSchema *rlmObjectSchema,
                            std::unique_ptr<realm::ObjectSchema> schema)
 : realm(realm)
 , rlmObjectSchema(rlmObjectSchema)
 , objectSchema(&*schema)
+, frozen(realm->_realm && realm->_realm->is_frozen())
+, columnKeys(columnKeysForSchema(*objectSchema))
 , dynamicObjectSchema(std::move(schema))
 , dynamicRLMObjectSchema(rlmObjectSchema)
 { }
@@ -90,6 +103,10 @@ realm::ColKey RLMClassInfo::computedTableColumn(RLMProperty *property) const {
     return originTable->get_opposite_column(forwardLinkKey);
 }
 
+void RLMClassInfo::updateColumnKeys() {
+    columnKeys = columnKeysForSchema(*objectSchema);
+}
+
 RLMClassInfo &RLMClassInfo::linkTargetType(size_t propertyIndex) {
     return realm->_info[rlmObjectSchema.properties[propertyIndex].objectClassName];
 }
@@ -135,6 +152,12 @@ RLMClassInfo* RLMSchemaInfo::operator[](realm::TableKey const& key) {
     return nullptr;
 }
 
+void RLMSchemaInfo::updateColumnKeys() {
+    for (auto& [name, info] : m_objects) {
+        info.updateColumnKeys();
+    }
+}
+
 RLMSchemaInfo::RLMSchemaInfo(RLMRealm *realm) {
     RLMSchema *rlmSchema = realm.schema;
     realm::Schema const& schema = realm->_realm->schema();
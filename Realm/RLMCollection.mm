@@ -26,6 +26,7 @@
 #import "RLMObject_Private.hpp"
 #import "RLMObservation.hpp"
 #import "RLMProperty_Private.h"
+#import "RLMQueryUtil.hpp"
 #import "RLMSet_Private.hpp"
 #import "RLMSwiftCollectionBase.h"
 
@@ -45,6 +46,9 @@ static const int RLMEnumerationBufferSize = 16;
 
     RLMRealm *_realm;
     RLMClassInfo *_info;
+    // Whether this enumerator needs to be detached when a write transaction
+    // begins, which is never the case for frozen Realms
+    bool _registered;
 
     // A pointer to either _snapshot or a Results from the source collection,
     // to avoid having to copy the Results when not in a write transaction
@@ -70,7 +74,7 @@ static const int RLMEnumerationBufferSize = 16;
         else {
             _snapshot = backingCollection.as_results();
             _collection = collection;
-            [_realm registerEnumerator:self];
+            [self registerWithRealm];
         }
         _results = &_snapshot;
     }
@@ -91,7 +95,7 @@ static const int RLMEnumerationBufferSize = 16;
         else {
             _snapshot = backingDictionary.get_keys();
             _collection = dictionary;
-            [_realm registerEnumerator:self];
+            [self registerWithRealm];
         }
         _results = &_snapshot;
     }
@@ -112,14 +116,21 @@ static const int RLMEnumerationBufferSize = 16;
         else {
             _results = &results;
             _collection = collection;
-            [_realm registerEnumerator:self];
+            [self registerWithRealm];
         }
     }
     return self;
 }
 
+- (void)registerWithRealm {
+    if (!_realm.frozen) {
+        _registered = true;
+        [_realm registerEnumerator:self];
+    }
+}
+
 - (void)dealloc {
-    if (_collection) {
+    if (_registered) {
         [_realm unregisterEnumerator:self];
     }
 }
@@ -160,8 +171,9 @@ static const int RLMEnumerationBufferSize = 16;
     if (batchCount == 0) {
         // Release our data if we're done, as we're autoreleased and so may
         // stick around for a while
-        if (_collection) {
-            _collection = nil;
+        _collection = nil;
+        if (_registered) {
+            _registered = false;
             [_realm unregisterEnumerator:self];
         }
 
@@ -176,6 +188,62 @@ static const int RLMEnumerationBufferSize = 16;
 }
 @end
 
+@implementation RLMObjectKeyArray {
+    RLMRealm *_realm;
+    std::vector<RLMClassInfo *> _infos;
+    std::vector<std::pair<uint32_t, realm::ObjKey>> _keys;
+    std::vector<id> _objects;
+}
+
+- (instancetype)initWithRealm:(RLMRealm *)realm
+                        infos:(std::vector<RLMClassInfo *>&&)infos
+                         keys:(std::vector<std::pair<uint32_t, realm::ObjKey>>&&)keys
+                 cacheObjects:(bool)cacheObjects {
+    if ((self = [super init])) {
+        _realm = realm;
+        _infos = std::move(infos);
+        _keys = std::move(keys);
+        if (cacheObjects) {
+            _objects.resize(_keys.size());
+        }
+    }
+    return self;
+}
+
+- (NSUInteger)count {
+    return _keys.size();
+}
+
+- (id)createObjectAtIndex:(NSUInteger)index {
+    [_realm verifyThread];
+    RLMClassInfo& info = *_infos[_keys[index].first];
+    realm::ObjKey key = _keys[index].second;
+    return RLMTranslateError([&] {
+        realm::TableRef table = info.table();
+        if (!table->is_valid(key)) {
+            @throw RLMException(@"Object has been deleted or invalidated.");
+        }
+        return RLMCreateObjectAccessor(info, table->get_object(key));
+    });
+}
+
+- (id)objectAtIndex:(NSUInteger)index {
+    if (index >= _keys.size()) {
+        @throw RLMException(@"Index %llu is out of bounds (must be less than %llu).",
+                            (unsigned long long)index, (unsigned long long)_keys.size());
+    }
+    if (_objects.empty()) {
+        return [self createObjectAtIndex:index];
+    }
+    id& object = _objects[index];
+    if (!object) {
+        object = [self createObjectAtIndex:index];
+    }
+    return object;
+}
+
+@end
+
 NSUInteger RLMFastEnumerate(NSFastEnumerationState *state,
                             NSUInteger len,
                             id<RLMFastEnumerable> collection) {
@@ -216,6 +284,7 @@ NSArray *RLMCollectionValueForKey(Collection& collection, NSString *key, RLMClas
         return array;
     }
 
+    RLMVerifyNoPendingLazyMigration(info, @[key]);
     RLMObject *accessor = RLMCreateManagedAccessor(info.rlmObjectSchema.accessorClass, &info);
     auto prop = info.rlmObjectSchema[key];
 
@@ -254,7 +323,9 @@ realm::ColKey columnForProperty(NSString *propertyName,
                                 RLMPropertyType propertyType,
                                 RLMCollectionType collectionType) {
     if (backingCollection.get_type() == realm::PropertyType::Object) {
-        return objectInfo->tableColumn(propertyName);
+        auto column = objectInfo->tableColumn(propertyName);
+        RLMVerifyNoPendingLazyMigration(*objectInfo, @[propertyName]);
+        return column;
     }
     if (![propertyName isEqualToString:@"self"]) {
         NSString *collectionTypeName;
@@ -18,6 +18,7 @@
 
 #import <Realm/RLMCollection_Private.h>
 
+#import <realm/keys.hpp>
 #import <realm/object-store/collection_notifications.hpp>
 
 #import <vector>
@@ -74,6 +75,18 @@ class RLMClassInfo;
 @end
 NSUInteger RLMFastEnumerate(NSFastEnumerationState *state, NSUInteger len, id<RLMFastEnumerable> collection);
 
+// An array of objects which stores only the type and key of each object, and
+// creates the accessor for an element when it is accessed. If `cacheObjects`
+// is true the accessor is kept for future accesses, and otherwise a new
+// accessor is created for each access so that the array uses a small fixed
+// amount of memory per element.
+@interface RLMObjectKeyArray : NSArray
+- (instancetype)initWithRealm:(RLMRealm *)realm
+                        infos:(std::vector<RLMClassInfo *>&&)infos
+                         keys:(std::vector<std::pair<uint32_t, realm::ObjKey>>&&)keys
+                 cacheObjects:(bool)cacheObjects;
+@end
+
 @interface RLMNotificationToken ()
 - (void)suppressNextNotification;
 - (RLMRealm *)realm;
@@ -453,6 +453,7 @@ static void RLMInsertObject(RLMManagedArray *ar, id object, NSUInteger index) {
 
 - (RLMResults *)sortedResultsUsingDescriptors:(NSArray<RLMSortDescriptor *> *)properties {
     return translateErrors([&] {
+        RLMVerifyNoPendingLazyMigration(*_objectInfo, [properties valueForKey:@"keyPath"]);
         return [RLMResults resultsWithObjectInfo:*_objectInfo
                                          results:_backingList.sort(RLMSortDescriptorsToKeypathArray(properties))];
     });
@@ -469,6 +470,7 @@ static void RLMInsertObject(RLMManagedArray *ar, id object, NSUInteger index) {
     if (_type != RLMPropertyTypeObject) {
         @throw RLMException(@"Querying is currently only implemented for arrays of Realm Objects");
     }
+    RLMVerifyNoPendingLazyMigration(*_objectInfo, predicate);
     auto query = RLMPredicateToQuery(predicate, _objectInfo->rlmObjectSchema, _realm.schema, _realm.group);
     auto results = translateErrors([&] { return _backingList.filter(std::move(query)); });
     return [RLMResults resultsWithObjectInfo:*_objectInfo results:std::move(results)];
@@ -478,6 +480,7 @@ static void RLMInsertObject(RLMManagedArray *ar, id object, NSUInteger index) {
     if (_type != RLMPropertyTypeObject) {
         @throw RLMException(@"Querying is currently only implemented for arrays of Realm Objects");
     }
+    RLMVerifyNoPendingLazyMigration(*_objectInfo, predicate);
     realm::Query query = RLMPredicateToQuery(predicate, _objectInfo->rlmObjectSchema,
                                              _realm.schema, _realm.group);
 
@@ -496,6 +496,7 @@ static NSMutableArray *resultsToArray(RLMClassInfo& info, realm::Results r) {
 
 - (RLMResults *)sortedResultsUsingDescriptors:(NSArray<RLMSortDescriptor *> *)properties {
     return translateErrors([&] {
+        RLMVerifyNoPendingLazyMigration(*_objectInfo, [properties valueForKey:@"keyPath"]);
         return [RLMResults resultsWithObjectInfo:*_objectInfo
                                          results:_backingCollection.as_results().sort(RLMSortDescriptorsToKeypathArray(properties))];
     });
@@ -516,6 +517,7 @@ static NSMutableArray *resultsToArray(RLMClassInfo& info, realm::Results r) {
     if (_type != RLMPropertyTypeObject) {
         @throw RLMException(@"Querying is currently only implemented for dictionaries of Realm Objects");
     }
+    RLMVerifyNoPendingLazyMigration(*_objectInfo, predicate);
     auto query = RLMPredicateToQuery(predicate, _objectInfo->rlmObjectSchema, _realm.schema, _realm.group);
     auto results = translateErrors([&] {
         return _backingCollection.as_results().filter(std::move(query));
@@ -490,6 +490,7 @@ static void ensureInWriteTransaction(NSString *message, RLMManagedSet *set, RLMM
 
 - (RLMResults *)sortedResultsUsingDescriptors:(NSArray<RLMSortDescriptor *> *)properties {
     return translateErrors([&] {
+        RLMVerifyNoPendingLazyMigration(*_objectInfo, [properties valueForKey:@"keyPath"]);
         return [RLMResults  resultsWithObjectInfo:*_objectInfo
                                           results:_backingSet.sort(RLMSortDescriptorsToKeypathArray(properties))];
     });
@@ -506,6 +507,7 @@ static void ensureInWriteTransaction(NSString *message, RLMManagedSet *set, RLMM
     if (_type != RLMPropertyTypeObject) {
         @throw RLMException(@"Querying is currently only implemented for sets of Realm Objects");
     }
+    RLMVerifyNoPendingLazyMigration(*_objectInfo, predicate);
     auto query = RLMPredicateToQuery(predicate, _objectInfo->rlmObjectSchema, _realm.schema, _realm.group);
     auto results = translateErrors([&] { return _backingSet.filter(std::move(query)); });
     return [RLMResults resultsWithObjectInfo:*_objectInfo results:std::move(results)];
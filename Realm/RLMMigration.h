@@ -17,6 +17,7 @@
 ////////////////////////////////////////////////////////////////////////////
 
 #import <Foundation/Foundation.h>
+#import <Realm/RLMConstants.h>
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -35,6 +36,62 @@ NS_ASSUME_NONNULL_BEGIN
 */
 typedef void (^RLMObjectMigrationBlock)(RLMObject * __nullable oldObject, RLMObject * __nullable newObject);
 
+/**
+ A UTF-8 string value stored in an `RLMMigrationColumnBuffer`. The bytes are
+ not guaranteed to be null-terminated.
+ */
+typedef struct RLMMigrationStringValue {
+    /// A pointer to the UTF-8 encoded bytes of the string.
+    const char * __nullable data;
+    /// The number of bytes pointed to by `data`.
+    NSUInteger length;
+} RLMMigrationStringValue;
+
+/**
+ A buffer of values for a single property, passed to an `RLMMigrationColumnFunction`.
+
+ The layout of `values` depends on `type`:
+
+ - `RLMPropertyTypeInt`: `int64_t`
+ - `RLMPropertyTypeBool`: `bool`
+ - `RLMPropertyTypeFloat`: `float`
+ - `RLMPropertyTypeDouble`: `double`
+ - `RLMPropertyTypeDate`: `double`, the number of seconds since 1970-01-01 00:00:00 UTC
+ - `RLMPropertyTypeString`: `RLMMigrationStringValue`
+ - `RLMPropertyTypeObjectId`: `uint8_t[12]`, the raw bytes of the ObjectId
+
+ Other property types cannot be used with column functions.
+ */
+typedef struct RLMMigrationColumnBuffer {
+    /// The type of the values stored in this buffer.
+    RLMPropertyType type;
+    /// Whether the property is optional. Null values may only be read from or
+    /// written to optional properties.
+    bool optional;
+    /// For each row, whether the value is null. The contents of `values` for
+    /// null rows are unspecified.
+    bool *isNull;
+    /// A pointer to the values for each row, laid out as described above.
+    void *values;
+} RLMMigrationColumnBuffer;
+
+/**
+ A function which computes new property values from old property values during a migration.
+
+ The function is called repeatedly with batches of `count` rows. `inputs` contains one buffer for each
+ of the old properties requested, and `outputs` contains one buffer for each of the new properties which
+ must be filled in by the function. Every row of every output buffer must be written to, either with a
+ value or by setting `isNull` to `true` for optional properties.
+
+ Strings written to output buffers must remain valid until the function is next called or the transform
+ completes. Input string values point into the Realm file and must not be modified.
+
+ @see `-[RLMMigration transformPropertiesForClass:oldProperties:newProperties:function:context:]`
+ */
+typedef void (*RLMMigrationColumnFunction)(void * __nullable context, NSUInteger count,
+                                           const RLMMigrationColumnBuffer *inputs, NSUInteger inputCount,
+                                           RLMMigrationColumnBuffer *outputs, NSUInteger outputCount);
+
 /**
  `RLMMigration` instances encapsulate information intended to facilitate a schema migration.
 
@@ -122,6 +179,64 @@ typedef void (^RLMObjectMigrationBlock)(RLMObject * __nullable oldObject, RLMObj
  */
 - (void)renamePropertyForClass:(NSString *)className oldName:(NSString *)oldName newName:(NSString *)newName;
 
+#pragma mark - Bulk Property Operations
+
+/**
+ Copies the values of a property from the old Realm schema to a property in the new Realm schema.
+
+ This operates directly on the underlying storage and does not create object accessors, making it
+ much faster than setting the values from within `-enumerateObjects:block:` for large tables.
+
+ If the types of the two properties differ, each value is converted to the new type. Numbers can be
+ converted to and from strings, integers to and from floating point values and doubles to floats when no
+ precision would be lost, strings to ObjectIds, UUIDs and Decimal128s, and integers to ObjectIds (stored big-endian in the
+ last eight bytes of the ObjectId). An exception will be thrown if a value cannot be converted, or if
+ a null value is copied to a required property.
+
+ Only non-collection properties which are not links to other objects are supported.
+
+ @param className   The name of the class whose property should be copied. This class must be present
+                    in both the old and new Realm schemas.
+ @param oldName     The name of the property in the old Realm schema to read values from.
+ @param newName     The name of the property in the new Realm schema to write values to.
+ */
+- (void)copyPropertyForClass:(NSString *)className oldName:(NSString *)oldName newName:(NSString *)newName;
+
+/**
+ Converts the values of a property whose type has changed between the old and new Realm schemas.
+
+ This is equivalent to calling `-copyPropertyForClass:oldName:newName:` with the same name for
+ both properties.
+
+ @param className   The name of the class whose property should be converted. This class must be present
+                    in both the old and new Realm schemas.
+ @param property    The name of the property to convert.
+ */
+- (void)convertPropertyForClass:(NSString *)className property:(NSString *)property;
+
+/**
+ Computes the values of one or more properties in the new Realm schema from the values of one or more
+ properties in the old Realm schema, using a C function operating on batches of typed values.
+
+ This can be used to fill in a new property with a computed value, to split one old property into
+ several new properties, or to merge several old properties into one new property. No object accessors
+ or Objective-C objects are created for the values being transformed.
+
+ @param className       The name of the class whose properties should be transformed. This class must
+                        be present in both the old and new Realm schemas.
+ @param oldProperties   The names of the properties in the old Realm schema to read. May be empty.
+ @param newProperties   The names of the properties in the new Realm schema to write. Must not be empty.
+ @param function        The function which computes the new values.
+ @param context         An arbitrary pointer which is passed to each invocation of `function`.
+
+ @see `RLMMigrationColumnBuffer`
+ */
+- (void)transformPropertiesForClass:(NSString *)className
+                      oldProperties:(NSArray<NSString *> *)oldProperties
+                      newProperties:(NSArray<NSString *> *)newProperties
+                           function:(RLMMigrationColumnFunction)function
+                            context:(nullable void *)context;
+
 @end
 
 NS_ASSUME_NONNULL_END
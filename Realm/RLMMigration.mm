@@ -19,12 +19,15 @@
 #import "RLMMigration_Private.h"
 
 #import "RLMAccessor.h"
+#import "RLMAccessor.hpp"
 #import "RLMObject_Private.h"
 #import "RLMObject_Private.hpp"
 #import "RLMObjectSchema_Private.hpp"
 #import "RLMObjectStore.h"
 #import "RLMProperty_Private.h"
+#import "RLMQueryUtil.hpp"
 #import "RLMRealm_Dynamic.h"
+#import "RLMRealmConfiguration_Private.hpp"
 #import "RLMRealm_Private.hpp"
 #import "RLMResults_Private.hpp"
 #import "RLMSchema_Private.hpp"
@@ -35,8 +38,524 @@
 #import <realm/object-store/schema.hpp>
 #import <realm/table.hpp>
 
+#import <algorithm>
+#import <atomic>
+#import <cmath>
+#import <limits>
+#import <mutex>
+#import <sstream>
+#import <unordered_set>
+
 using namespace realm;
 
+namespace {
+// Number of rows read into the typed buffers for each call to a
+// RLMMigrationColumnFunction
+constexpr size_t s_migrationBatchSize = 1024;
+
+RLMProperty *validatedColumnProperty(RLMClassInfo& info, NSString *name, bool columnFunction) {
+    RLMProperty *prop = RLMValidatedProperty(info.rlmObjectSchema, name);
+    if (prop.collection || prop.type == RLMPropertyTypeObject || prop.type == RLMPropertyTypeLinkingObjects) {
+        @throw RLMException(@"Property '%@.%@' of type '%@' cannot be used for bulk property operations in a migration.",
+                            info.rlmObjectSchema.className, name, prop.typeName);
+    }
+    if (columnFunction) {
+        switch (prop.type) {
+            case RLMPropertyTypeInt:
+            case RLMPropertyTypeBool:
+            case RLMPropertyTypeFloat:
+            case RLMPropertyTypeDouble:
+            case RLMPropertyTypeDate:
+            case RLMPropertyTypeString:
+            case RLMPropertyTypeObjectId:
+                break;
+            default:
+                @throw RLMException(@"Property '%@.%@' of type '%@' cannot be used with a migration column function.",
+                                    info.rlmObjectSchema.className, name, prop.typeName);
+        }
+    }
+    return prop;
+}
+
+[[noreturn]] void throwConversionError(Mixed const& value, RLMProperty *prop) {
+    std::string description;
+    if (value.get_type() == type_String) {
+        description = value.get_string();
+    }
+    else {
+        std::stringstream ss;
+        ss << value;
+        description = ss.str();
+    }
+    @throw RLMException(@"Cannot convert value '%s' to type '%@' for property '%@'.",
+                        description.c_str(), prop.typeName, prop.name);
+}
+
+std::string formatFloatingPoint(double value, int digits) {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.*g", digits, value);
+    return buffer;
+}
+
+// Convert a value read from the old Realm to the type of the given property in
+// the new Realm. Strings produced by the conversion are stored in `buffer`, so
+// the returned Mixed is only valid until the next call using the same buffer.
+Mixed convertValue(Mixed const& value, RLMProperty *prop, std::string& buffer) {
+    if (value.is_null()) {
+        if (!prop.optional) {
+            @throw RLMException(@"Cannot copy null value to required property '%@'.", prop.name);
+        }
+        return value;
+    }
+
+    auto type = value.get_type();
+    switch (prop.type) {
+        case RLMPropertyTypeAny:
+            return value;
+        case RLMPropertyTypeInt:
+            if (type == type_Int) {
+                return value;
+            }
+            if (type == type_Bool) {
+                return int64_t(value.get_bool());
+            }
+            if (type == type_Float || type == type_Double) {
+                double d = type == type_Float ? value.get_float() : value.get_double();
+                if (std::trunc(d) != d || d < double(std::numeric_limits<int64_t>::min())
+                    || d >= double(std::numeric_limits<int64_t>::max())) {
+                    throwConversionError(value, prop);
+                }
+                return int64_t(d);
+            }
+            if (type == type_String) {
+                buffer = value.get_string();
+                char *end;
+                errno = 0;
+                long long result = strtoll(buffer.c_str(), &end, 10);
+                if (buffer.empty() || *end || errno == ERANGE) {
+                    throwConversionError(value, prop);
+                }
+                return int64_t(result);
+            }
+            break;
+        case RLMPropertyTypeBool:
+            if (type == type_Bool) {
+                return value;
+            }
+            if (type == type_Int && (value.get_int() == 0 || value.get_int() == 1)) {
+                return value.get_int() == 1;
+            }
+            if (type == type_String) {
+                auto str = value.get_string();
+                if (str == "true") {
+                    return true;
+                }
+                if (str == "false") {
+                    return false;
+                }
+            }
+            break;
+        case RLMPropertyTypeFloat:
+        case RLMPropertyTypeDouble: {
+            double d;
+            if (type == type_Float) {
+                d = value.get_float();
+            }
+            else if (type == type_Double) {
+                d = value.get_double();
+            }
+            else if (type == type_Int) {
+                // Integers beyond 2^53 (2^24 for floats) are silently rounded
+                // by the conversion, so reject anything which doesn't round-trip
+                int64_t i = value.get_int();
+                d = double(i);
+                if (d >= double(std::numeric_limits<int64_t>::max()) || int64_t(d) != i) {
+                    throwConversionError(value, prop);
+                }
+            }
+            else if (type == type_String) {
+                buffer = value.get_string();
+                char *end;
+                errno = 0;
+                d = prop.type == RLMPropertyTypeFloat ? strtof(buffer.c_str(), &end) : strtod(buffer.c_str(), &end);
+                if (buffer.empty() || *end || errno == ERANGE) {
+                    throwConversionError(value, prop);
+                }
+            }
+            else {
+                break;
+            }
+            if (prop.type == RLMPropertyTypeFloat) {
+                float f = float(d);
+                if (type != type_String && !std::isnan(d) && double(f) != d) {
+                    throwConversionError(value, prop);
+                }
+                return f;
+            }
+            return d;
+        }
+        case RLMPropertyTypeString:
+            switch (type) {
+                case type_String:
+                    return value;
+                case type_Int:
+                    buffer = std::to_string(value.get_int());
+                    break;
+                case type_Bool:
+                    buffer = value.get_bool() ? "true" : "false";
+                    break;
+                case type_Float:
+                    buffer = formatFloatingPoint(value.get_float(), std::numeric_limits<float>::max_digits10);
+                    break;
+                case type_Double:
+                    buffer = formatFloatingPoint(value.get_double(), std::numeric_limits<double>::max_digits10);
+                    break;
+                case type_ObjectId:
+                    buffer = value.get_object_id().to_string();
+                    break;
+                case type_UUID:
+                    buffer = value.get_uuid().to_string();
+                    break;
+                case type_Decimal:
+                    buffer = value.get_decimal().to_string();
+                    break;
+                default:
+                    throwConversionError(value, prop);
+            }
+            return StringData(buffer);
+        case RLMPropertyTypeData:
+            if (type == type_Binary) {
+                return value;
+            }
+            if (type == type_String) {
+                auto str = value.get_string();
+                return BinaryData(str.data(), str.size());
+            }
+            break;
+        case RLMPropertyTypeDate:
+            if (type == type_Timestamp) {
+                return value;
+            }
+            break;
+        case RLMPropertyTypeObjectId:
+            if (type == type_ObjectId) {
+                return value;
+            }
+            if (type == type_String) {
+                buffer = value.get_string();
+                if (ObjectId::is_valid_str(buffer)) {
+                    return ObjectId(buffer.c_str());
+                }
+            }
+            if (type == type_Int) {
+                ObjectIdBytes bytes{};
+                uint64_t i = value.get_int();
+                for (size_t j = 0; j < 8; ++j) {
+                    bytes[11 - j] = uint8_t(i >> (j * 8));
+                }
+                return ObjectId(bytes);
+            }
+            break;
+        case RLMPropertyTypeUUID:
+            if (type == type_UUID) {
+                return value;
+            }
+            if (type == type_String) {
+                buffer = value.get_string();
+                if (UUID::is_valid_string(buffer)) {
+                    return UUID(buffer);
+                }
+            }
+            break;
+        case RLMPropertyTypeDecimal128:
+            if (type == type_Decimal) {
+                return value;
+            }
+            if (type == type_Int) {
+                return Decimal128(value.get_int());
+            }
+            if (type == type_Double) {
+                return Decimal128(value.get_double());
+            }
+            if (type == type_String) {
+                buffer = value.get_string();
+                if (Decimal128::is_valid_str(buffer)) {
+                    return Decimal128(StringData(buffer));
+                }
+            }
+            break;
+        case RLMPropertyTypeObject:
+        case RLMPropertyTypeLinkingObjects:
+            break;
+    }
+    throwConversionError(value, prop);
+}
+
+size_t columnBufferElementSize(RLMPropertyType type) {
+    switch (type) {
+        case RLMPropertyTypeInt:      return sizeof(int64_t);
+        case RLMPropertyTypeBool:     return sizeof(bool);
+        case RLMPropertyTypeFloat:    return sizeof(float);
+        case RLMPropertyTypeDouble:   return sizeof(double);
+        case RLMPropertyTypeDate:     return sizeof(double);
+        case RLMPropertyTypeString:   return sizeof(RLMMigrationStringValue);
+        case RLMPropertyTypeObjectId: return sizeof(ObjectIdBytes);
+        default: REALM_UNREACHABLE();
+    }
+}
+
+// Owns the storage for a single RLMMigrationColumnBuffer
+struct ColumnStorage {
+    RLMProperty *property;
+    ColKey column;
+    std::unique_ptr<bool[]> nulls;
+    std::unique_ptr<char[]> values;
+
+    ColumnStorage(RLMProperty *prop, ColKey col)
+    : property(prop)
+    , column(col)
+    , nulls(new bool[s_migrationBatchSize]())
+    , values(new char[s_migrationBatchSize * columnBufferElementSize(prop.type)]())
+    { }
+
+    RLMMigrationColumnBuffer buffer() {
+        return {property.type, static_cast<bool>(property.optional), nulls.get(), values.get()};
+    }
+
+    template<typename T>
+    T& at(size_t i) {
+        return reinterpret_cast<T *>(values.get())[i];
+    }
+
+    void read(const Obj& obj, size_t i) {
+        Mixed value = obj.get_any(column);
+        nulls[i] = value.is_null();
+        if (nulls[i]) {
+            return;
+        }
+        switch (property.type) {
+            case RLMPropertyTypeInt:    at<int64_t>(i) = value.get_int(); break;
+            case RLMPropertyTypeBool:   at<bool>(i) = value.get_bool(); break;
+            case RLMPropertyTypeFloat:  at<float>(i) = value.get_float(); break;
+            case RLMPropertyTypeDouble: at<double>(i) = value.get_double(); break;
+            case RLMPropertyTypeDate: {
+                auto ts = value.get_timestamp();
+                at<double>(i) = ts.get_seconds() + ts.get_nanoseconds() / 1'000'000'000.0;
+                break;
+            }
+            case RLMPropertyTypeString: {
+                // The string data points into the mmapped file, which is
+                // stable for the duration of the old Realm's read transaction
+                auto str = value.get_string();
+                at<RLMMigrationStringValue>(i) = {str.data(), str.size()};
+                break;
+            }
+            case RLMPropertyTypeObjectId:
+                at<ObjectIdBytes>(i) = value.get_object_id().to_bytes();
+                break;
+            default:
+                REALM_UNREACHABLE();
+        }
+    }
+
+    void write(Obj& obj, size_t i) {
+        if (nulls[i]) {
+            if (!property.optional) {
+                @throw RLMException(@"Migration column function returned null for required property '%@'.", property.name);
+            }
+            obj.set_null(column);
+            return;
+        }
+        switch (property.type) {
+            case RLMPropertyTypeInt:    obj.set(column, at<int64_t>(i)); break;
+            case RLMPropertyTypeBool:   obj.set(column, at<bool>(i)); break;
+            case RLMPropertyTypeFloat:  obj.set(column, at<float>(i)); break;
+            case RLMPropertyTypeDouble: obj.set(column, at<double>(i)); break;
+            case RLMPropertyTypeDate: {
+                double seconds = at<double>(i);
+                // 2^63 is exactly representable as a double, while INT64_MAX is not
+                if (!std::isfinite(seconds) || seconds < -0x1p63 || seconds >= 0x1p63) {
+                    @throw RLMException(@"Migration column function returned invalid date %f for property '%@'.",
+                                        seconds, property.name);
+                }
+                auto s = static_cast<int64_t>(seconds);
+                auto ns = static_cast<int32_t>((seconds - s) * 1'000'000'000.0);
+                obj.set(column, Timestamp(s, ns));
+                break;
+            }
+            case RLMPropertyTypeString: {
+                auto& str = at<RLMMigrationStringValue>(i);
+                obj.set(column, StringData(str.data ?: "", str.length));
+                break;
+            }
+            case RLMPropertyTypeObjectId:
+                obj.set(column, ObjectId(at<ObjectIdBytes>(i)));
+                break;
+            default:
+                REALM_UNREACHABLE();
+        }
+    }
+};
+
+// Invoke `fn` with each object which exists in both the old and new Realm,
+// bypassing the accessors entirely
+template<typename Fn>
+void forEachMigratedObject(RLMClassInfo& oldInfo, RLMClassInfo& newInfo, Fn&& fn) {
+    TableRef oldTable = oldInfo.table();
+    TableRef newTable = newInfo.table();
+    if (!oldTable || !newTable) {
+        return;
+    }
+    for (auto oldObj : *oldTable) {
+        auto key = oldObj.get_key();
+        if (!newTable->is_valid(key)) {
+            continue;
+        }
+        Obj newObj = newTable->get_object(key);
+        fn(oldObj, newObj);
+    }
+}
+
+
+// The chunked migration state is stored in a table without the "class_"
+// prefix so that it is not part of the object schema
+constexpr const char *c_chunkedMigrationTableName = "rlm_chunked_migration";
+constexpr const char *c_chunkedMigrationClassColumn = "class_name";
+constexpr const char *c_chunkedMigrationCursorColumn = "cursor";
+constexpr const char *c_chunkedMigrationVersionColumn = "old_schema_version";
+
+// Get the index of the first object in the table whose key is greater than
+// the cursor. Objects are stored in key order, so this is a binary search.
+size_t firstIndexAfterCursor(Table& table, int64_t cursor) {
+    size_t lo = 0, hi = table.size();
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (table.get_object(mid).get_key().value <= cursor) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+// The lazy migration state is stored in a table without the "class_" prefix
+// so that it is not part of the object schema
+constexpr const char *c_lazyMigrationTableName = "rlm_lazy_migration";
+constexpr const char *c_lazyMigrationClassColumn = "class_name";
+constexpr const char *c_lazyMigrationPropertyColumn = "property_name";
+constexpr const char *c_lazyMigrationCursorColumn = "cursor";
+constexpr const char *c_lazyMigrationMaxKeyColumn = "max_key";
+
+std::atomic<bool> s_lazyMigrationSweepEnabled{true};
+
+// Split a "ClassName.propertyName" key for a lazy property migration block
+std::pair<NSString *, NSString *> splitLazyMigrationKey(NSString *key) {
+    NSRange range = [key rangeOfString:@"."];
+    if (range.location == NSNotFound) {
+        @throw RLMException(@"Invalid lazy property migration key '%@': keys must be of the form 'ClassName.propertyName'.",
+                            key);
+    }
+    return {[key substringToIndex:range.location], [key substringFromIndex:range.location + 1]};
+}
+
+// Find the state of the lazy migration for the given property, returning an
+// invalid Obj if the migration is not pending
+Obj findLazyMigrationState(Table& table, StringData className, StringData propertyName) {
+    ColKey classCol = table.get_column_key(c_lazyMigrationClassColumn);
+    ColKey propertyCol = table.get_column_key(c_lazyMigrationPropertyColumn);
+    for (auto state : table) {
+        if (state.get<StringData>(classCol) == className && state.get<StringData>(propertyCol) == propertyName) {
+            return state;
+        }
+    }
+    return Obj();
+}
+
+// Throw if a lazy migration block returned a value which can't be stored in
+// the property
+id validatedLazyMigrationValue(RLMClassInfo& info, RLMProperty *prop, id value) {
+    if (!RLMIsObjectValidForProperty(value, prop)) {
+        @throw RLMException(@"Invalid value '%@' of type '%@' returned by the lazy migration block for property '%@.%@' of type '%@'.",
+                            value, [value class], info.rlmObjectSchema.className, prop.name, prop.typeName);
+    }
+    return value;
+}
+
+// Get the lazy migration for the property if it is still pending for the
+// object, refreshing the cached cursors if the read version has changed
+RLMLazyMigrationInfo::Property *pendingLazyMigration(RLMObjectBase *obj, NSUInteger propertyIndex) {
+    RLMClassInfo& info = *obj->_info;
+    auto& lazy = *info.lazyMigration;
+    auto& sharedRealm = *obj->_realm->_realm;
+    auto version = sharedRealm.read_transaction_version().version;
+    if (version != lazy.version) {
+        lazy.version = version;
+        bool pending = false;
+        TableRef stateTable = sharedRealm.read_group().get_table(c_lazyMigrationTableName);
+        StringData className = RLMStringDataWithNSString(info.rlmObjectSchema.className);
+        for (auto& prop : lazy.properties) {
+            prop.cursor = prop.maxKey = -1;
+            if (!stateTable) {
+                continue;
+            }
+            if (Obj state = findLazyMigrationState(*stateTable, className, RLMStringDataWithNSString(prop.name));
+                state.is_valid()) {
+                prop.cursor = state.get<int64_t>(stateTable->get_column_key(c_lazyMigrationCursorColumn));
+                prop.maxKey = state.get<int64_t>(stateTable->get_column_key(c_lazyMigrationMaxKeyColumn));
+                pending = true;
+            }
+        }
+        // Once the sweep has completed the stored values are always current,
+        // so there's no need to check again for this type
+        if (!pending) {
+            info.lazyMigration.reset();
+            return nullptr;
+        }
+    }
+
+    auto it = std::find_if(lazy.properties.begin(), lazy.properties.end(),
+                           [&](auto& prop) { return prop.index == propertyIndex; });
+    auto key = obj->_row.get_key().value;
+    if (it == lazy.properties.end() || key <= it->cursor || key > it->maxKey) {
+        return nullptr;
+    }
+    return &*it;
+}
+
+// Run the lazy migration sweep for the Realm at the configuration's path on a
+// background queue, unless one is already running in this process
+void startLazyMigrationSweep(RLMRealmConfiguration *configuration) {
+    static auto& mutex = *new std::mutex;
+    static auto& paths = *new std::unordered_set<std::string>;
+    std::string path = configuration.config.path;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!paths.insert(path).second) {
+            return;
+        }
+    }
+
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+        @autoreleasepool {
+            try {
+                NSError *error;
+                if (RLMRealm *realm = [RLMRealm realmWithConfiguration:configuration error:&error]) {
+                    RLMRunLazyMigrationSweep(realm, configuration, &error);
+                }
+            }
+            catch (...) {
+                // Any chunks which were committed are kept, and the sweep is
+                // resumed the next time the Realm is opened
+            }
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        paths.erase(path);
+    });
+}
+} // anonymous namespace
+
 // The source realm for a migration has to use a SharedGroup to be able to share
 // the file with the destination realm, but we don't want to let the user call
 // beginWriteTransaction on it as that would make no sense.
@@ -134,7 +653,9 @@ using namespace realm;
             objectSchema.accessorClass = RLMDynamicObject.class;
         }
 
-        block(self, _oldRealm->_realm->schema_version());
+        if (block) {
+            block(self, _oldRealm->_realm->schema_version());
+        }
 
         _oldRealm = nil;
         _realm = nil;
@@ -175,6 +696,500 @@ using namespace realm;
 - (void)renamePropertyForClass:(NSString *)className oldName:(NSString *)oldName newName:(NSString *)newName {
     realm::ObjectStore::rename_property(_realm.group, *_schema, className.UTF8String,
                                         oldName.UTF8String, newName.UTF8String);
+    // The renamed property now uses the old property's column
+    _realm->_info[className].updateColumnKeys();
+}
+
+- (void)scheduleChunkedMigrationForClasses:(NSArray<NSString *> *)classNames {
+    if (classNames.count == 0) {
+        return;
+    }
+
+    Group& group = _realm.group;
+    TableRef table = group.get_or_add_table(c_chunkedMigrationTableName);
+    if (table->get_column_count() == 0) {
+        table->add_column(type_String, c_chunkedMigrationClassColumn);
+        table->add_column(type_Int, c_chunkedMigrationCursorColumn);
+        table->add_column(type_Int, c_chunkedMigrationVersionColumn);
+    }
+    ColKey classCol = table->get_column_key(c_chunkedMigrationClassColumn);
+    ColKey cursorCol = table->get_column_key(c_chunkedMigrationCursorColumn);
+    ColKey versionCol = table->get_column_key(c_chunkedMigrationVersionColumn);
+
+    auto oldVersion = static_cast<int64_t>(_oldRealm->_realm->schema_version());
+    for (NSString *className in classNames) {
+        if (![_realm.schema schemaForClassName:className]) {
+            @throw RLMException(@"Chunked migration block provided for type '%@' which is not present in the schema.",
+                                className);
+        }
+        StringData name = RLMStringDataWithNSString(className);
+        ObjKey key = table->find_first_string(classCol, name);
+        Obj state = key ? table->get_object(key) : table->create_object();
+        state.set(classCol, name);
+        // Restart from the beginning if a previous chunked migration for this
+        // type never completed, as the migration block may depend on it
+        state.set<int64_t>(cursorCol, -1);
+        state.set(versionCol, oldVersion);
+    }
+}
+
+- (void)scheduleLazyMigrationForProperties:(NSArray<NSString *> *)keys {
+    if (keys.count == 0) {
+        return;
+    }
+
+    Group& group = _realm.group;
+    TableRef table = group.get_or_add_table(c_lazyMigrationTableName);
+    if (table->get_column_count() == 0) {
+        table->add_column(type_String, c_lazyMigrationClassColumn);
+        table->add_column(type_String, c_lazyMigrationPropertyColumn);
+        table->add_column(type_Int, c_lazyMigrationCursorColumn);
+        table->add_column(type_Int, c_lazyMigrationMaxKeyColumn);
+    }
+    ColKey classCol = table->get_column_key(c_lazyMigrationClassColumn);
+    ColKey propertyCol = table->get_column_key(c_lazyMigrationPropertyColumn);
+    ColKey cursorCol = table->get_column_key(c_lazyMigrationCursorColumn);
+    ColKey maxKeyCol = table->get_column_key(c_lazyMigrationMaxKeyColumn);
+
+    for (NSString *key in keys) {
+        auto names = splitLazyMigrationKey(key);
+        NSString *className = names.first, *propertyName = names.second;
+        RLMProperty *prop = [_realm.schema schemaForClassName:className][propertyName];
+        if (!prop) {
+            @throw RLMException(@"Lazy property migration block provided for property '%@' which is not present in the schema.",
+                                key);
+        }
+        if (prop.collection || prop.isPrimary || prop.type == RLMPropertyTypeObject
+            || prop.type == RLMPropertyTypeLinkingObjects) {
+            @throw RLMException(@"Property '%@' of type '%@' cannot be migrated lazily.", key, prop.typeName);
+        }
+        // Only properties added by this migration are computed lazily, as
+        // existing properties already have valid stored values
+        if ([_oldRealm.schema schemaForClassName:className][propertyName]) {
+            continue;
+        }
+
+        StringData classNameData = RLMStringDataWithNSString(className);
+        StringData propertyNameData = RLMStringDataWithNSString(propertyName);
+        Obj state = findLazyMigrationState(*table, classNameData, propertyNameData);
+        if (!state.is_valid()) {
+            state = table->create_object();
+            state.set(classCol, classNameData);
+            state.set(propertyCol, propertyNameData);
+        }
+        state.set<int64_t>(cursorCol, -1);
+
+        // Only the objects which exist now are migrated. Objects created
+        // after this have their values set by the app rather than the block.
+        TableRef objectTable = ObjectStore::table_for_object_type(group, className.UTF8String);
+        size_t size = objectTable ? objectTable->size() : 0;
+        state.set<int64_t>(maxKeyCol, size ? objectTable->get_object(size - 1).get_key().value : -1);
+    }
+}
+
+- (void)validateClassForBulkOperation:(NSString *)className {
+    if (![_oldRealm.schema schemaForClassName:className] || ![_realm.schema schemaForClassName:className]) {
+        @throw RLMException(@"Cannot perform bulk property operations on type '%@' because it is not present in both the old and new schemas.",
+                            className);
+    }
+}
+
+- (void)copyPropertyForClass:(NSString *)className oldName:(NSString *)oldName newName:(NSString *)newName {
+    [self validateClassForBulkOperation:className];
+    RLMClassInfo& oldInfo = _oldRealm->_info[className];
+    RLMClassInfo& newInfo = _realm->_info[className];
+    RLMProperty *oldProp = validatedColumnProperty(oldInfo, oldName, false);
+    RLMProperty *newProp = validatedColumnProperty(newInfo, newName, false);
+    ColKey oldCol = oldInfo.tableColumn(oldProp);
+    ColKey newCol = newInfo.tableColumn(newProp);
+
+    std::string buffer;
+    RLMTranslateError([&] {
+        forEachMigratedObject(oldInfo, newInfo, [&](const Obj& oldObj, Obj& newObj) {
+            newObj.set_any(newCol, convertValue(oldObj.get_any(oldCol), newProp, buffer));
+        });
+    });
+}
+
+- (void)convertPropertyForClass:(NSString *)className property:(NSString *)property {
+    [self copyPropertyForClass:className oldName:property newName:property];
+}
+
+- (void)transformPropertiesForClass:(NSString *)className
+                      oldProperties:(NSArray<NSString *> *)oldProperties
+                      newProperties:(NSArray<NSString *> *)newProperties
+                           function:(RLMMigrationColumnFunction)function
+                            context:(void *)context {
+    if (newProperties.count == 0) {
+        @throw RLMException(@"At least one new property must be specified for a migration column function.");
+    }
+    [self validateClassForBulkOperation:className];
+    RLMClassInfo& oldInfo = _oldRealm->_info[className];
+    RLMClassInfo& newInfo = _realm->_info[className];
+
+    std::vector<ColumnStorage> inputs, outputs;
+    inputs.reserve(oldProperties.count);
+    outputs.reserve(newProperties.count);
+    for (NSString *name in oldProperties) {
+        RLMProperty *prop = validatedColumnProperty(oldInfo, name, true);
+        inputs.emplace_back(prop, oldInfo.tableColumn(prop));
+    }
+    for (NSString *name in newProperties) {
+        RLMProperty *prop = validatedColumnProperty(newInfo, name, true);
+        outputs.emplace_back(prop, newInfo.tableColumn(prop));
+    }
+
+    std::vector<RLMMigrationColumnBuffer> inputBuffers, outputBuffers;
+    for (auto& input : inputs) {
+        inputBuffers.push_back(input.buffer());
+    }
+    for (auto& output : outputs) {
+        outputBuffers.push_back(output.buffer());
+    }
+
+    std::vector<Obj> batch;
+    batch.reserve(s_migrationBatchSize);
+    auto flush = [&] {
+        if (batch.empty()) {
+            return;
+        }
+        for (auto& output : outputs) {
+            std::fill_n(output.nulls.get(), batch.size(), false);
+        }
+        function(context, batch.size(), inputBuffers.data(), inputBuffers.size(),
+                 outputBuffers.data(), outputBuffers.size());
+        for (size_t i = 0; i < batch.size(); ++i) {
+            for (auto& output : outputs) {
+                output.write(batch[i], i);
+            }
+        }
+        batch.clear();
+    };
+
+    RLMTranslateError([&] {
+        forEachMigratedObject(oldInfo, newInfo, [&](const Obj& oldObj, Obj& newObj) {
+            for (auto& input : inputs) {
+                input.read(oldObj, batch.size());
+            }
+            batch.push_back(newObj);
+            if (batch.size() == s_migrationBatchSize) {
+                flush();
+            }
+        });
+        flush();
+    });
 }
 
 @end
+
+BOOL RLMRunPendingChunkedMigration(RLMRealm *realm, RLMRealmConfiguration *configuration,
+                                   NSError **error) {
+    auto& sharedRealm = *realm->_realm;
+    // Only end the read transaction if we were the ones to begin it, as the
+    // SharedRealm may be shared with an already-open Realm on this thread
+    bool wasInReadTransaction = sharedRealm.is_in_read_transaction();
+    auto endRead = [&] {
+        if (!wasInReadTransaction) {
+            sharedRealm.invalidate();
+        }
+    };
+
+    TableRef stateTable = sharedRealm.read_group().get_table(c_chunkedMigrationTableName);
+    if (!stateTable || stateTable->is_empty()) {
+        endRead();
+        return YES;
+    }
+
+    ColKey classCol = stateTable->get_column_key(c_chunkedMigrationClassColumn);
+    ColKey cursorCol = stateTable->get_column_key(c_chunkedMigrationCursorColumn);
+    ColKey versionCol = stateTable->get_column_key(c_chunkedMigrationVersionColumn);
+
+    // Validate that we can complete the migration and count the remaining work
+    // before doing anything
+    NSDictionary<NSString *, RLMChunkedMigrationBlock> *blocks = configuration.chunkedMigrationBlocks;
+    NSMutableArray<NSString *> *classNames = [NSMutableArray new];
+    NSUInteger totalObjects = 0;
+    for (auto state : *stateTable) {
+        NSString *className = RLMStringDataToNSString(state.get<StringData>(classCol));
+        if (!blocks[className] || configuration.readOnly || realm.dynamic
+            || ![realm.schema schemaForClassName:className]) {
+            NSString *message = [NSString stringWithFormat:@"Realm at path '%@' has an incomplete chunked migration for type '%@' which must be completed before it can be opened.",
+                                 configuration.pathOnDisk, className];
+            endRead();
+            RLMSetErrorOrThrow([NSError errorWithDomain:RLMErrorDomain
+                                                   code:RLMErrorSchemaMismatch
+                                               userInfo:@{NSLocalizedDescriptionKey: message}],
+                               error);
+            return NO;
+        }
+        [classNames addObject:className];
+        TableRef table = realm->_info[className].table();
+        totalObjects += table->size() - firstIndexAfterCursor(*table, state.get<int64_t>(cursorCol));
+    }
+
+    NSUInteger chunkSize = configuration.migrationChunkSize;
+    RLMMigrationProgressBlock progress = configuration.migrationProgressBlock;
+    NSUInteger migratedObjects = 0;
+    std::vector<ObjKey> keys;
+    keys.reserve(chunkSize);
+
+    for (NSString *className in classNames) {
+        RLMChunkedMigrationBlock block = blocks[className];
+        RLMClassInfo& info = realm->_info[className];
+        StringData name = RLMStringDataWithNSString(className);
+        bool done = false;
+        while (!done) {
+            @autoreleasepool {
+                [realm beginWriteTransaction];
+                try {
+                    // Re-read the state inside the write transaction as another
+                    // process may have migrated some or all of this type while
+                    // we were waiting for the write lock
+                    stateTable = sharedRealm.read_group().get_table(c_chunkedMigrationTableName);
+                    ObjKey stateKey = stateTable->find_first_string(classCol, name);
+                    if (!stateKey) {
+                        [realm cancelWriteTransaction];
+                        break;
+                    }
+                    Obj state = stateTable->get_object(stateKey);
+                    auto oldVersion = static_cast<uint64_t>(state.get<int64_t>(versionCol));
+
+                    TableRef table = info.table();
+                    keys.clear();
+                    size_t size = table->size();
+                    for (size_t i = firstIndexAfterCursor(*table, state.get<int64_t>(cursorCol));
+                         i < size && keys.size() < chunkSize; ++i) {
+                        keys.push_back(table->get_object(i).get_key());
+                    }
+
+                    for (ObjKey key : keys) {
+                        // The object may have been deleted by the block for a
+                        // previous object
+                        if (!table->is_valid(key)) {
+                            continue;
+                        }
+                        block((RLMObject *)RLMCreateObjectAccessor(info, table->get_object(key)), oldVersion);
+                    }
+
+                    done = keys.size() < chunkSize;
+                    if (done) {
+                        state.remove();
+                    }
+                    else {
+                        state.set(cursorCol, keys.back().value);
+                    }
+                }
+                catch (...) {
+                    if (realm.inWriteTransaction) {
+                        [realm cancelWriteTransaction];
+                    }
+                    endRead();
+                    throw;
+                }
+                if (![realm commitWriteTransaction:error]) {
+                    endRead();
+                    return NO;
+                }
+            }
+
+            migratedObjects = std::min(migratedObjects + keys.size(), totalObjects);
+            if (progress) {
+                progress(migratedObjects, totalObjects);
+            }
+        }
+    }
+
+    endRead();
+    return YES;
+}
+
+BOOL RLMAttachLazyMigrations(RLMRealm *realm, RLMRealmConfiguration *configuration,
+                             bool *hasPendingMigrations, NSError **error) {
+    auto& sharedRealm = *realm->_realm;
+    bool wasInReadTransaction = sharedRealm.is_in_read_transaction();
+    NSMutableArray<NSString *> *pendingKeys = [NSMutableArray new];
+    if (TableRef stateTable = sharedRealm.read_group().get_table(c_lazyMigrationTableName)) {
+        ColKey classCol = stateTable->get_column_key(c_lazyMigrationClassColumn);
+        ColKey propertyCol = stateTable->get_column_key(c_lazyMigrationPropertyColumn);
+        for (auto state : *stateTable) {
+            [pendingKeys addObject:[NSString stringWithFormat:@"%@.%@",
+                                    RLMStringDataToNSString(state.get<StringData>(classCol)),
+                                    RLMStringDataToNSString(state.get<StringData>(propertyCol))]];
+        }
+    }
+    if (!wasInReadTransaction) {
+        sharedRealm.invalidate();
+    }
+    *hasPendingMigrations = pendingKeys.count > 0;
+    if (!pendingKeys.count) {
+        return YES;
+    }
+
+    // The cursors are read the first time each property is read, as they can
+    // be advanced by the sweep at any point after this
+    NSDictionary<NSString *, RLMLazyPropertyMigrationBlock> *blocks = configuration.lazyPropertyMigrationBlocks;
+    for (NSString *key in pendingKeys) {
+        auto names = splitLazyMigrationKey(key);
+        RLMProperty *prop = [realm.schema schemaForClassName:names.first][names.second];
+        if (!prop) {
+            continue;
+        }
+        // As with chunked migrations, the Realm can't be used without the
+        // block as the stored values aren't valid yet
+        RLMLazyPropertyMigrationBlock block = blocks[key];
+        if (!block || realm.dynamic) {
+            NSString *message = [NSString stringWithFormat:@"Realm at path '%@' has an incomplete lazy migration for property '%@' which must be completed before it can be opened.",
+                                 configuration.pathOnDisk, key];
+            RLMSetErrorOrThrow([NSError errorWithDomain:RLMErrorDomain
+                                                   code:RLMErrorSchemaMismatch
+                                               userInfo:@{NSLocalizedDescriptionKey: message}],
+                               error);
+            return NO;
+        }
+        RLMClassInfo& info = realm->_info[names.first];
+        if (!info.lazyMigration) {
+            info.lazyMigration = std::make_unique<RLMLazyMigrationInfo>();
+        }
+        info.lazyMigration->properties.push_back({prop.index, names.second, block, -1, -1});
+    }
+
+    if (!configuration.readOnly && s_lazyMigrationSweepEnabled) {
+        startLazyMigrationSweep(configuration);
+    }
+    return YES;
+}
+
+void RLMCopyLazyMigrations(RLMRealm *source, RLMRealm *target) {
+    for (auto& [name, info] : source->_info) {
+        if (!info.lazyMigration) {
+            continue;
+        }
+        auto copy = std::make_unique<RLMLazyMigrationInfo>();
+        for (auto& prop : info.lazyMigration->properties) {
+            copy->properties.push_back({prop.index, prop.name, prop.block, -1, -1});
+        }
+        target->_info[name].lazyMigration = std::move(copy);
+    }
+}
+
+BOOL RLMRunLazyMigrationSweep(RLMRealm *realm, RLMRealmConfiguration *configuration,
+                              NSError **error) {
+    auto& sharedRealm = *realm->_realm;
+    NSDictionary<NSString *, RLMLazyPropertyMigrationBlock> *blocks = configuration.lazyPropertyMigrationBlocks;
+    NSUInteger chunkSize = configuration.migrationChunkSize;
+    std::vector<ObjKey> keys;
+    keys.reserve(chunkSize);
+
+    for (NSString *key in blocks) {
+        auto names = splitLazyMigrationKey(key);
+        NSString *className = names.first, *propertyName = names.second;
+        if (![realm.schema schemaForClassName:className][propertyName]) {
+            continue;
+        }
+        RLMLazyPropertyMigrationBlock block = blocks[key];
+        RLMClassInfo& info = realm->_info[className];
+        RLMProperty *prop = info.rlmObjectSchema[propertyName];
+        StringData classNameData = RLMStringDataWithNSString(className);
+        StringData propertyNameData = RLMStringDataWithNSString(propertyName);
+        bool done = false;
+        while (!done) {
+            @autoreleasepool {
+                [realm beginWriteTransaction];
+                try {
+                    // Re-read the state inside the write transaction as another
+                    // process may have swept some or all of this property
+                    TableRef stateTable = sharedRealm.read_group().get_table(c_lazyMigrationTableName);
+                    Obj state = stateTable ? findLazyMigrationState(*stateTable, classNameData, propertyNameData) : Obj();
+                    if (!state.is_valid()) {
+                        [realm cancelWriteTransaction];
+                        break;
+                    }
+                    ColKey cursorCol = stateTable->get_column_key(c_lazyMigrationCursorColumn);
+                    int64_t maxKey = state.get<int64_t>(stateTable->get_column_key(c_lazyMigrationMaxKeyColumn));
+
+                    TableRef table = info.table();
+                    keys.clear();
+                    size_t size = table->size();
+                    for (size_t i = firstIndexAfterCursor(*table, state.get<int64_t>(cursorCol));
+                         i < size && keys.size() < chunkSize; ++i) {
+                        ObjKey objKey = table->get_object(i).get_key();
+                        if (objKey.value > maxKey) {
+                            break;
+                        }
+                        keys.push_back(objKey);
+                    }
+
+                    // Pending properties can't be set by the app, so this
+                    // never replaces a value which was written after the
+                    // migration was scheduled
+                    for (ObjKey objKey : keys) {
+                        RLMObjectBase *obj = RLMCreateObjectAccessor(info, table->get_object(objKey));
+                        id value = validatedLazyMigrationValue(info, prop, block((RLMObject *)obj));
+                        RLMDynamicSet(obj, prop, RLMCoerceToNil(value));
+                    }
+
+                    done = keys.size() < chunkSize || keys.back().value == maxKey;
+                    if (done) {
+                        state.remove();
+                    }
+                    else {
+                        state.set(cursorCol, keys.back().value);
+                    }
+                }
+                catch (...) {
+                    if (realm.inWriteTransaction) {
+                        [realm cancelWriteTransaction];
+                    }
+                    throw;
+                }
+                if (![realm commitWriteTransaction:error]) {
+                    return NO;
+                }
+            }
+        }
+    }
+    return YES;
+}
+
+RLMOptionalId RLMLazyMigratedValue(RLMObjectBase *obj, NSUInteger propertyIndex) {
+    auto pending = pendingLazyMigration(obj, propertyIndex);
+    if (!pending) {
+        return RLMOptionalId{nil};
+    }
+    RLMClassInfo& info = *obj->_info;
+    id value = validatedLazyMigrationValue(info, info.rlmObjectSchema.properties[propertyIndex],
+                                           pending->block((RLMObject *)obj));
+    return RLMOptionalId{value ?: NSNull.null};
+}
+
+void RLMVerifyNotPendingLazyMigration(RLMObjectBase *obj, NSUInteger propertyIndex) {
+    if (pendingLazyMigration(obj, propertyIndex)) {
+        @throw RLMException(@"Cannot set property '%@.%@' until its lazy migration has completed.",
+                            obj->_info->rlmObjectSchema.className,
+                            obj->_info->rlmObjectSchema.properties[propertyIndex].name);
+    }
+}
+
+NSSet<NSString *> *RLMPendingLazyMigrationProperties(Group& group, NSString *className) {
+    TableRef table = group.get_table(c_lazyMigrationTableName);
+    if (!table || table->is_empty()) {
+        return nil;
+    }
+    ColKey classCol = table->get_column_key(c_lazyMigrationClassColumn);
+    ColKey propertyCol = table->get_column_key(c_lazyMigrationPropertyColumn);
+    StringData name = RLMStringDataWithNSString(className);
+    NSMutableSet<NSString *> *properties;
+    for (auto state : *table) {
+        if (state.get<StringData>(classCol) == name) {
+            if (!properties) {
+                properties = [NSMutableSet new];
+            }
+            [properties addObject:RLMStringDataToNSString(state.get<StringData>(propertyCol))];
+        }
+    }
+    return properties;
+}
+
+void RLMSetLazyMigrationSweepEnabled(bool enabled) {
+    s_lazyMigrationSweepEnabled = enabled;
+}
@@ -19,10 +19,13 @@
 #import <Realm/RLMMigration.h>
 #import <Realm/RLMObjectBase.h>
 #import <Realm/RLMRealm.h>
+#import <Realm/RLMRealmConfiguration.h>
 
 namespace realm {
+    class Group;
     class Schema;
 }
+struct RLMOptionalId;
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -33,8 +36,56 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (instancetype)initWithRealm:(RLMRealm *)realm oldRealm:(RLMRealm *)oldRealm schema:(realm::Schema &)schema;
 
-- (void)execute:(RLMMigrationBlock)block;
+- (void)execute:(nullable RLMMigrationBlock)block;
+
+// Record that the objects of the given types need to be passed to their
+// chunked migration blocks once the schema change has been committed
+- (void)scheduleChunkedMigrationForClasses:(NSArray<NSString *> *)classNames;
+
+// Record that the given properties, in "ClassName.propertyName" form, should be
+// computed lazily if they were added by this migration
+- (void)scheduleLazyMigrationForProperties:(NSArray<NSString *> *)keys;
 
 @end
 
+// Run the chunked migration blocks for any scheduled but incomplete chunked
+// migrations, committing after each chunk. Returns NO and sets the error if
+// the configuration does not have the required blocks.
+BOOL RLMRunPendingChunkedMigration(RLMRealm *realm, RLMRealmConfiguration *configuration,
+                                   NSError **error);
+
+// Register the configuration's lazy property migration blocks on the Realm's
+// class info for any lazy migrations which are pending in the file, and start
+// a background sweep to complete them if the Realm is writeable. Returns NO and
+// sets the error if the configuration does not have the required blocks.
+BOOL RLMAttachLazyMigrations(RLMRealm *realm, RLMRealmConfiguration *configuration,
+                             bool *hasPendingMigrations, NSError **error);
+
+// Register the lazy property migrations of the source Realm on the target
+// Realm, which must be a frozen copy of it
+void RLMCopyLazyMigrations(RLMRealm *source, RLMRealm *target);
+
+// Store the computed values for all pending lazy property migrations which have
+// blocks in the configuration, committing after each chunk of objects
+BOOL RLMRunLazyMigrationSweep(RLMRealm *realm, RLMRealmConfiguration *configuration,
+                              NSError **error);
+
+// Get the lazily computed value of the persisted property at the given index
+// if its migration has not yet been applied to the object, or an empty value
+// if the stored value is current. Null values are returned as NSNull.
+RLMOptionalId RLMLazyMigratedValue(RLMObjectBase *obj, NSUInteger propertyIndex);
+
+// Throw if the persisted property at the given index has a lazy migration which
+// has not yet been applied to the object, as the sweep would replace the value
+void RLMVerifyNotPendingLazyMigration(RLMObjectBase *obj, NSUInteger propertyIndex);
+
+// Get the names of the properties of the given type which have pending lazy
+// migrations in the file, or nil if there are none
+NSSet<NSString *> *_Nullable RLMPendingLazyMigrationProperties(realm::Group& group,
+                                                                NSString *className);
+
+// Set whether opening a Realm with pending lazy migrations starts a background
+// sweep. Used by the tests to observe the pending state.
+void RLMSetLazyMigrationSweepEnabled(bool enabled);
+
 NS_ASSUME_NONNULL_END
@@ -23,7 +23,8 @@
 NS_ASSUME_NONNULL_BEGIN
 @protocol RLMBSON;
 
-@class RLMFindOptions, RLMFindOneAndModifyOptions, RLMUpdateResult, RLMChangeStream, RLMObjectId;
+@class RLMFindOptions, RLMFindOneAndModifyOptions, RLMUpdateResult, RLMChangeStream, RLMObjectId, RLMRawChangeEvent;
+@class RLMRealmConfiguration;
 
 /// Delegate which is used for subscribing to changes on a `[RLMMongoCollection watch]` stream.
 @protocol RLMChangeEventDelegate
@@ -39,6 +40,31 @@ NS_ASSUME_NONNULL_BEGIN
 /// Invoked when a change event has been received.
 /// @param changeEvent The change event in BSON format.
 - (void)changeStreamDidReceiveChangeEvent:(id<RLMBSON>)changeEvent;
+
+@optional
+/// Invoked with all of the change events which were received from the server
+/// at once. If implemented, this is called instead of
+/// `changeStreamDidReceiveChangeEvent:`.
+/// @param changeEvents The change events in BSON format.
+- (void)changeStreamDidReceiveChangeEvents:(NSArray<id<RLMBSON>> *)changeEvents;
+/// Invoked with all of the change events which were received from the server
+/// at once, without converting them to BSON. If implemented, this is called
+/// instead of the other change event methods, and each event is only parsed
+/// when its `document` is read.
+/// @param changeEvents The unparsed change events.
+- (void)changeStreamDidReceiveRawChangeEvents:(NSArray<RLMRawChangeEvent *> *)changeEvents;
+@end
+
+/// A change event which has been received from a watch stream but not yet
+/// converted to BSON.
+@interface RLMRawChangeEvent : NSObject
+/// The change event as MongoDB Extended JSON.
+@property (nonatomic, readonly) NSData *extendedJSON;
+/// The change event in BSON format. The event is parsed the first time this is
+/// read, and this is `nil` if the event is not a valid BSON document.
+@property (nonatomic, readonly, nullable) id<RLMBSON> document;
+/// :nodoc:
+- (instancetype)init NS_UNAVAILABLE;
 @end
 
 /// Acts as a middleman and processes events with WatchStream
@@ -70,8 +96,18 @@ NS_ASSUME_NONNULL_BEGIN
 typedef void(^RLMMongoInsertBlock)(id<RLMBSON> _Nullable, NSError * _Nullable);
 /// Block which returns an array of object ids on a successful insertMany, or an error should one occur.
 typedef void(^RLMMongoInsertManyBlock)(NSArray<id<RLMBSON>> * _Nullable, NSError * _Nullable);
+/// Block which is called with the number of documents which have been inserted so far and the total number of documents
+/// during a chunked insertMany operation.
+typedef void(^RLMMongoInsertManyProgressBlock)(NSUInteger, NSUInteger);
+/// Block which returns the object ids of the inserted documents for each chunk of a chunked insertMany operation, and an
+/// error should one occur.
+typedef void(^RLMMongoInsertManyChunksBlock)(NSArray<NSArray<id<RLMBSON>> *> *, NSError * _Nullable);
 /// Block which returns an array of Documents on a successful find operation, or an error should one occur.
 typedef void(^RLMMongoFindBlock)(NSArray<NSDictionary<NSString *, id<RLMBSON>> *> * _Nullable, NSError * _Nullable);
+/// Block which is called with each page of Documents from a paginated find operation. Return `NO` to stop the operation.
+typedef BOOL(^RLMMongoFindPageBlock)(NSArray<NSDictionary<NSString *, id<RLMBSON>> *> *);
+/// Block which is called once a paginated find operation has finished, with an error should one occur.
+typedef void(^RLMMongoFindPagesCompletionBlock)(NSError * _Nullable);
 /// Block which returns a Document on a successful findOne operation, or an error should one occur.
 typedef void(^RLMMongoFindOneBlock)(NSDictionary<NSString *, id<RLMBSON>> * _Nullable, NSError * _Nullable);
 /// Block which returns the number of Documents in a collection on a successful count operation, or an error should one occur.
@@ -98,6 +134,28 @@ typedef void(^RLMMongoDeleteBlock)(NSDictionary<NSString *, id<RLMBSON>> * _Null
 - (void)insertManyDocuments:(NSArray<NSDictionary<NSString *, id<RLMBSON>> *> *)documents
                  completion:(RLMMongoInsertManyBlock)completion NS_REFINED_FOR_SWIFT;
 
+/// Encodes the provided values to BSON and inserts them using a separate request for each chunk of documents.
+/// If any values are missing identifiers, they will be generated.
+///
+/// Each chunk is only encoded when its request is sent, and at most `maxConcurrentRequests` requests are in flight
+/// at once. No further chunks are sent once a chunk fails to insert, but the requests which are already in flight
+/// are allowed to finish before the completion block is called.
+/// @param documents The `Document` values in a bson array to insert.
+/// @param chunkSize The maximum number of documents to insert in each request.
+/// @param maxConcurrentRequests The maximum number of requests to have in flight at once.
+/// @param progressBlock Called after each chunk is inserted with the number of documents inserted so far and the
+///                      total number of documents. Calls are made in order on a serial background queue and
+///                      never concurrently, and all of them are made before `completion` is called.
+/// @param completion Called once all of the requests have finished with the ids of the inserted documents for each
+///                   chunk, in the same order as `documents`, and the first error to occur. The ids for chunks which
+///                   were not inserted are empty arrays. Chunk `i` contains the documents starting at index
+///                   `i * chunkSize`.
+- (void)insertManyDocuments:(NSArray<NSDictionary<NSString *, id<RLMBSON>> *> *)documents
+                  chunkSize:(NSUInteger)chunkSize
+      maxConcurrentRequests:(NSUInteger)maxConcurrentRequests
+              progressBlock:(nullable RLMMongoInsertManyProgressBlock)progressBlock
+                 completion:(RLMMongoInsertManyChunksBlock)completion NS_REFINED_FOR_SWIFT;
+
 /// Finds the documents in this collection which match the provided filter.
 /// @param filterDocument A `Document` as bson that should match the query.
 /// @param options `RLMFindOptions` to use when executing the command.
@@ -112,6 +170,57 @@ typedef void(^RLMMongoDeleteBlock)(NSDictionary<NSString *, id<RLMBSON>> * _Null
 - (void)findWhere:(NSDictionary<NSString *, id<RLMBSON>> *)filterDocument
        completion:(RLMMongoFindBlock)completion NS_REFINED_FOR_SWIFT;
 
+/// Finds the documents in this collection which match the provided filter, one page at a time.
+///
+/// Documents are fetched in order of `_id` using a separate request for each page, and the next page is not
+/// requested until `pageBlock` returns, so only a single page of documents is held in memory at once. Returning
+/// `NO` from `pageBlock` stops the operation without fetching any further pages.
+///
+/// Each page after the first only matches documents whose `_id` compares greater than the last one delivered, which
+/// in MongoDB only matches values of the same type, so the `_id` of every matching document must be of the same type.
+/// If documents with an `_id` of a different type would have been skipped, `completion` is called with an error.
+///
+/// @param filterDocument A `Document` as bson that should match the query.
+/// @param options `RLMFindOptions` to use when executing the command. The `limit` applies to the total number of
+///                documents returned, and `_id` is always included in the projection. A `sort` cannot be used.
+/// @param pageSize The maximum number of documents in each page.
+/// @param pageBlock The block called with each page of documents.
+/// @param completion The block called once all of the pages have been delivered, or an error occurs.
+- (void)findWhere:(NSDictionary<NSString *, id<RLMBSON>> *)filterDocument
+          options:(RLMFindOptions *)options
+         pageSize:(NSUInteger)pageSize
+        pageBlock:(RLMMongoFindPageBlock)pageBlock
+       completion:(RLMMongoFindPagesCompletionBlock)completion NS_REFINED_FOR_SWIFT;
+
+/// Finds the documents in this collection which match the provided filter and
+/// writes them directly into a Realm as objects of the given type.
+///
+/// The documents are converted straight from BSON to Realm values without
+/// creating intermediate `NSDictionary` objects, and all of them are written
+/// in a single write transaction. Each document field is stored in the property
+/// of the same name unless `fieldMapping` maps the field name to a different
+/// property name, and fields which do not correspond to a property are ignored.
+/// If the type has a primary key, existing objects with a matching primary key
+/// are updated, and only the properties whose values have changed are written.
+/// Properties of newly created objects which are missing from the document are
+/// set to their default values, and importing fails if a required property has
+/// neither a value nor a default value. Numbers are converted to the numeric
+/// type of the property only if they can be stored without losing precision.
+///
+/// @param filterDocument A `Document` as bson that should match the query.
+/// @param options `RLMFindOptions` to use when executing the command.
+/// @param configuration The configuration of the Realm to write the objects to.
+/// @param className The name of the object type to create. Must not be an embedded object type.
+/// @param fieldMapping A dictionary which maps document field names to property names.
+/// @param completion Called on a background thread with the number of documents
+///                   which were imported, or an error if one occurs.
+- (void)importDocumentsWhere:(NSDictionary<NSString *, id<RLMBSON>> *)filterDocument
+                     options:(RLMFindOptions *)options
+               configuration:(RLMRealmConfiguration *)configuration
+                   className:(NSString *)className
+                fieldMapping:(nullable NSDictionary<NSString *, NSString *> *)fieldMapping
+                  completion:(RLMMongoCountBlock)completion NS_REFINED_FOR_SWIFT;
+
 /// Returns one document from a collection or view which matches the
 /// provided filter. If multiple documents satisfy the query, this method
 /// returns the first document according to the query's sort order or natural
@@ -18,23 +18,217 @@
 
 #import "RLMMongoCollection_Private.hpp"
 
+#import "RLMAccessor.h"
 #import "RLMApp_Private.hpp"
 #import "RLMBSON_Private.hpp"
+#import "RLMClassInfo.hpp"
 #import "RLMFindOneAndModifyOptions_Private.hpp"
 #import "RLMFindOptions_Private.hpp"
 #import "RLMNetworkTransport_Private.hpp"
+#import "RLMObjectSchema_Private.hpp"
+#import "RLMObjectStore.h"
+#import "RLMProperty_Private.h"
+#import "RLMRealmConfiguration.h"
+#import "RLMRealm_Private.hpp"
 #import "RLMUpdateResult_Private.hpp"
 #import "RLMUser_Private.hpp"
+#import "RLMUtil.hpp"
 
+#import <realm/object-store/sync/generic_network_transport.hpp>
 #import <realm/object-store/sync/mongo_client.hpp>
 #import <realm/object-store/sync/mongo_collection.hpp>
 #import <realm/object-store/sync/mongo_database.hpp>
+#import <realm/table.hpp>
+
+#import <cmath>
+#import <mutex>
+#import <sstream>
+
+namespace {
+// An incremental parser for the server-sent events format which reads lines
+// directly from the received bytes, buffering only a line which is split
+// between two chunks.
+class EventStreamParser {
+public:
+    // Calls `fn` with the type and data of each complete event in `input`
+    template<typename Fn>
+    void feed(std::string_view input, Fn&& fn) {
+        while (!input.empty()) {
+            if (m_skipLineFeed) {
+                m_skipLineFeed = false;
+                if (input[0] == '\n') {
+                    input.remove_prefix(1);
+                    continue;
+                }
+            }
+            size_t end = input.find_first_of("\r\n");
+            if (end == std::string_view::npos) {
+                m_partialLine.append(input);
+                return;
+            }
+            m_skipLineFeed = input[end] == '\r';
+            auto line = input.substr(0, end);
+            input.remove_prefix(end + 1);
+            if (m_partialLine.empty()) {
+                processLine(line, fn);
+            }
+            else {
+                m_partialLine.append(line);
+                processLine(m_partialLine, fn);
+                m_partialLine.clear();
+            }
+        }
+    }
+
+private:
+    std::string m_partialLine;
+    std::string m_eventType;
+    std::string m_data;
+    bool m_hasData = false;
+    bool m_skipLineFeed = false;
+
+    template<typename Fn>
+    void processLine(std::string_view line, Fn& fn) {
+        if (line.empty()) {
+            if (m_hasData) {
+                percentDecode(m_data);
+                fn(m_eventType.empty() ? std::string_view("message") : std::string_view(m_eventType), m_data);
+            }
+            m_eventType.clear();
+            m_data.clear();
+            m_hasData = false;
+            return;
+        }
+        if (line[0] == ':') {
+            return; // comment
+        }
+
+        auto colon = line.find(':');
+        auto field = line.substr(0, colon);
+        auto value = colon == std::string_view::npos ? std::string_view() : line.substr(colon + 1);
+        if (!value.empty() && value[0] == ' ') {
+            value.remove_prefix(1);
+        }
+        if (field == "data") {
+            if (m_hasData) {
+                m_data += '\n';
+            }
+            m_data.append(value);
+            m_hasData = true;
+        }
+        else if (field == "event") {
+            m_eventType.assign(value);
+        }
+    }
+
+    // The server percent-encodes the event data
+    static void percentDecode(std::string& str) {
+        if (str.find('%') == std::string::npos) {
+            return;
+        }
+        auto hex = [](char c) -> int {
+            if (c >= '0' && c <= '9') return c - '0';
+            if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+            if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+            return -1;
+        };
+        size_t out = 0;
+        for (size_t i = 0; i < str.size(); ++i) {
+            if (str[i] == '%' && i + 2 < str.size()) {
+                int high = hex(str[i + 1]), low = hex(str[i + 2]);
+                if (high >= 0 && low >= 0) {
+                    str[out++] = static_cast<char>(high * 16 + low);
+                    i += 2;
+                    continue;
+                }
+            }
+            str[out++] = str[i];
+        }
+        str.resize(out);
+    }
+};
+
+id<RLMBSON> parseChangeEvent(std::string_view data) {
+    try {
+        auto parsed = realm::bson::parse(data);
+        if (parsed.type() == realm::bson::Bson::Type::Document) {
+            return RLMConvertBsonToRLMBSON(parsed);
+        }
+    }
+    catch (...) {
+    }
+    return nil;
+}
+
+NSError *errorForEvent(std::string_view data) {
+    realm::app::AppError error(make_error_code(realm::app::ServiceErrorCode::unknown), std::string(data));
+    if (NSDictionary *dict = RLMDynamicCast<NSDictionary>(parseChangeEvent(data))) {
+        NSString *code = RLMDynamicCast<NSString>(dict[@"error_code"]);
+        NSString *message = RLMDynamicCast<NSString>(dict[@"error"]);
+        if (code && message) {
+            error = realm::app::AppError(make_error_code(realm::app::service_error_code_from_string(code.UTF8String)),
+                                         message.UTF8String);
+        }
+    }
+    return RLMAppErrorToNSError(error);
+}
+
+// The state of a chunked insertMany operation which is shared between the
+// callbacks for each of its requests
+struct ChunkedInsert {
+    ChunkedInsert(realm::app::MongoCollection collection) : collection(std::move(collection)) { }
+
+    realm::app::MongoCollection collection;
+    NSArray<NSDictionary<NSString *, id<RLMBSON>> *> *documents;
+    NSUInteger chunkSize;
+    NSUInteger chunkCount;
+    RLMMongoInsertManyProgressBlock progressBlock;
+    RLMMongoInsertManyChunksBlock completion;
+    // The progress block and then the completion are called on this queue so
+    // that they run in order and never while holding `mutex`
+    dispatch_queue_t callbackQueue;
+
+    std::mutex mutex;
+    NSUInteger nextChunk = 0;
+    NSUInteger inFlight = 0;
+    NSUInteger insertedCount = 0;
+    NSMutableArray<NSArray<id<RLMBSON>> *> *insertedIds;
+    NSError *error;
+};
+} // anonymous namespace
+
+@implementation RLMRawChangeEvent {
+    id<RLMBSON> _document;
+    bool _parsed;
+}
+
+- (instancetype)initWithExtendedJSON:(NSData *)extendedJSON {
+    if (self = [super init]) {
+        _extendedJSON = extendedJSON;
+    }
+    return self;
+}
+
+- (id<RLMBSON>)document {
+    @synchronized (self) {
+        if (!_parsed) {
+            _document = parseChangeEvent({static_cast<const char *>(_extendedJSON.bytes), _extendedJSON.length});
+            _parsed = true;
+        }
+        return _document;
+    }
+}
+
+@end
 
 @implementation RLMChangeStream {
-    realm::app::WatchStream _watchStream;
+    EventStreamParser _parser;
+    bool _failed;
     id<RLMChangeEventDelegate> _subscriber;
     __weak NSURLSession *_session;
     _Nonnull dispatch_queue_t _queue;
+    bool _deliverRaw;
+    bool _deliverBatches;
 }
 
 - (instancetype)initWithChangeEventSubscriber:(id<RLMChangeEventDelegate>)subscriber
@@ -42,6 +236,8 @@
     if (self = [super init]) {
         _subscriber = subscriber;
         _queue = queue ?: dispatch_get_main_queue();
+        _deliverRaw = [(id)subscriber respondsToSelector:@selector(changeStreamDidReceiveRawChangeEvents:)];
+        _deliverBatches = [(id)subscriber respondsToSelector:@selector(changeStreamDidReceiveChangeEvents:)];
         return self;
     }
     return nil;
@@ -65,21 +261,60 @@
     });
 }
 
-- (void)didReceiveEvent:(nonnull NSData *)event {
-    std::string_view str = [[NSString alloc] initWithData:event encoding:NSUTF8StringEncoding].UTF8String;
-    if (!str.empty() && _watchStream.state() == realm::app::WatchStream::State::NEED_DATA) {
-        _watchStream.feed_buffer(str);
+- (void)didReceiveEvent:(nonnull NSData *)data {
+    if (_failed) {
+        return;
     }
 
-    while (_watchStream.state() == realm::app::WatchStream::State::HAVE_EVENT) {
-        id<RLMBSON> event = RLMConvertBsonToRLMBSON(_watchStream.next_event());
+    // Parse every event in the chunk and then deliver them all at once
+    NSMutableArray *events = [NSMutableArray new];
+    __block NSError *error;
+    [data enumerateByteRangesUsingBlock:^(const void *bytes, NSRange range, BOOL *stop) {
+        _parser.feed({static_cast<const char *>(bytes), range.length}, [&](std::string_view type, std::string_view event) {
+            if (error) {
+                return;
+            }
+            if (type == "error") {
+                error = errorForEvent(event);
+            }
+            else if (type != "message") {
+                return;
+            }
+            else if (_deliverRaw) {
+                [events addObject:[[RLMRawChangeEvent alloc] initWithExtendedJSON:[NSData dataWithBytes:event.data()
+                                                                                                  length:event.size()]]];
+            }
+            else if (id<RLMBSON> bson = parseChangeEvent(event)) {
+                [events addObject:bson];
+            }
+            else {
+                error = RLMAppErrorToNSError(realm::app::AppError(make_error_code(realm::app::JSONErrorCode::bad_bson_parse),
+                                                                  "server returned malformed event: " + std::string(event)));
+            }
+        });
+        *stop = error != nil;
+    }];
+
+    if (events.count) {
+        id<RLMChangeEventDelegate> subscriber = _subscriber;
+        bool raw = _deliverRaw, batches = _deliverBatches;
         dispatch_async(_queue, ^{
-            [_subscriber changeStreamDidReceiveChangeEvent:event];
+            if (raw) {
+                [subscriber changeStreamDidReceiveRawChangeEvents:events];
+            }
+            else if (batches) {
+                [subscriber changeStreamDidReceiveChangeEvents:events];
+            }
+            else {
+                for (id<RLMBSON> event in events) {
+                    [subscriber changeStreamDidReceiveChangeEvent:event];
+                }
+            }
         });
     }
-
-    if (_watchStream.state() == realm::app::WatchStream::State::HAVE_ERROR) {
-        [self didReceiveError:RLMAppErrorToNSError(_watchStream.error())];
+    if (error) {
+        _failed = true;
+        [self didReceiveError:error];
     }
 }
 
@@ -93,6 +328,303 @@
 
 @end
 
+#pragma mark - Importing
+
+namespace {
+bool isNumber(realm::bson::Bson::Type type) {
+    using Type = realm::bson::Bson::Type;
+    return type == Type::Int32 || type == Type::Int64 || type == Type::Double;
+}
+
+bool isNumber(RLMPropertyType type) {
+    return type == RLMPropertyTypeInt || type == RLMPropertyTypeFloat || type == RLMPropertyTypeDouble;
+}
+
+// Converts a BSON value to the value stored in the column for a property of
+// the given type, or returns none if the value has to be converted by the
+// object accessor instead. Numbers are only converted between types when no
+// precision is lost, as with the bulk conversions in RLMMigration, and
+// otherwise return none. Strings and binary data are copied into `buffer`,
+// which must outlive the returned value.
+realm::util::Optional<realm::Mixed> bsonToMixed(const realm::bson::Bson& value, RLMPropertyType propertyType,
+                                                bool optional, std::string& buffer) {
+    using Type = realm::bson::Bson::Type;
+    auto type = value.type();
+    if (type == Type::Null) {
+        if (optional || propertyType == RLMPropertyTypeAny) {
+            return realm::Mixed();
+        }
+        return realm::util::none;
+    }
+
+    switch (propertyType) {
+        case RLMPropertyTypeInt:
+            if (type == Type::Int32) {
+                return realm::Mixed(int64_t(static_cast<int32_t>(value)));
+            }
+            if (type == Type::Int64) {
+                return realm::Mixed(static_cast<int64_t>(value));
+            }
+            if (type == Type::Double) {
+                // 2^63 is exactly representable as a double, while INT64_MAX is not
+                double d = static_cast<double>(value);
+                if (d >= -0x1p63 && d < 0x1p63 && std::trunc(d) == d) {
+                    return realm::Mixed(int64_t(d));
+                }
+            }
+            break;
+        case RLMPropertyTypeBool:
+            if (type == Type::Bool) {
+                return realm::Mixed(static_cast<bool>(value));
+            }
+            break;
+        case RLMPropertyTypeFloat:
+            if (type == Type::Double) {
+                double d = static_cast<double>(value);
+                float f = float(d);
+                if (std::isnan(d) || double(f) == d) {
+                    return realm::Mixed(f);
+                }
+            }
+            if (type == Type::Int32 || type == Type::Int64) {
+                int64_t i = type == Type::Int32 ? static_cast<int32_t>(value) : static_cast<int64_t>(value);
+                float f = float(i);
+                if (f < 0x1p63f && int64_t(f) == i) {
+                    return realm::Mixed(f);
+                }
+            }
+            break;
+        case RLMPropertyTypeDouble:
+            if (type == Type::Double) {
+                return realm::Mixed(static_cast<double>(value));
+            }
+            if (type == Type::Int32) {
+                return realm::Mixed(double(static_cast<int32_t>(value)));
+            }
+            if (type == Type::Int64) {
+                int64_t i = static_cast<int64_t>(value);
+                double d = double(i);
+                if (d < 0x1p63 && int64_t(d) == i) {
+                    return realm::Mixed(d);
+                }
+            }
+            break;
+        case RLMPropertyTypeString:
+            if (type == Type::String) {
+                buffer = static_cast<std::string>(value);
+                return realm::Mixed(realm::StringData(buffer));
+            }
+            break;
+        case RLMPropertyTypeData:
+            if (type == Type::Binary) {
+                auto bytes = static_cast<std::vector<char>>(value);
+                buffer.assign(bytes.begin(), bytes.end());
+                return realm::Mixed(realm::BinaryData(buffer.data(), buffer.size()));
+            }
+            break;
+        case RLMPropertyTypeDate:
+            if (type == Type::Datetime) {
+                return realm::Mixed(static_cast<realm::Timestamp>(value));
+            }
+            break;
+        case RLMPropertyTypeObjectId:
+            if (type == Type::ObjectId) {
+                return realm::Mixed(static_cast<realm::ObjectId>(value));
+            }
+            break;
+        case RLMPropertyTypeDecimal128:
+            if (type == Type::Decimal128) {
+                return realm::Mixed(static_cast<realm::Decimal128>(value));
+            }
+            break;
+        case RLMPropertyTypeUUID:
+            if (type == Type::Uuid) {
+                return realm::Mixed(static_cast<realm::UUID>(value));
+            }
+            break;
+        case RLMPropertyTypeAny:
+            // Mixed properties store the value with the type of the BSON value
+            switch (type) {
+                case Type::Int32:
+                case Type::Int64:
+                    return bsonToMixed(value, RLMPropertyTypeInt, false, buffer);
+                case Type::Bool:
+                    return bsonToMixed(value, RLMPropertyTypeBool, false, buffer);
+                case Type::Double:
+                    return bsonToMixed(value, RLMPropertyTypeDouble, false, buffer);
+                case Type::String:
+                    return bsonToMixed(value, RLMPropertyTypeString, false, buffer);
+                case Type::Binary:
+                    return bsonToMixed(value, RLMPropertyTypeData, false, buffer);
+                case Type::Datetime:
+                    return bsonToMixed(value, RLMPropertyTypeDate, false, buffer);
+                case Type::ObjectId:
+                    return bsonToMixed(value, RLMPropertyTypeObjectId, false, buffer);
+                case Type::Decimal128:
+                    return bsonToMixed(value, RLMPropertyTypeDecimal128, false, buffer);
+                case Type::Uuid:
+                    return bsonToMixed(value, RLMPropertyTypeUUID, false, buffer);
+                default:
+                    break;
+            }
+            break;
+        default:
+            break;
+    }
+    return realm::util::none;
+}
+} // anonymous namespace
+
+NSUInteger RLMImportBsonDocuments(RLMRealm *realm, NSString *className,
+                                  const realm::bson::BsonArray& documents,
+                                  NSDictionary<NSString *, NSString *> *fieldMapping) {
+    RLMVerifyInWriteTransaction(realm);
+    auto& info = realm->_info[className];
+    RLMObjectSchema *objectSchema = info.rlmObjectSchema;
+    if (objectSchema.isEmbedded) {
+        @throw RLMException(@"Embedded objects cannot be created directly");
+    }
+
+    // Resolve the property for each document field name once up front rather
+    // than for every document
+    NSMutableDictionary<NSString *, NSString *> *propertyNames = [NSMutableDictionary new];
+    for (RLMProperty *prop in objectSchema.properties) {
+        propertyNames[prop.name] = prop.name;
+    }
+    for (NSString *propertyName in fieldMapping.allValues) {
+        if (!objectSchema[propertyName]) {
+            @throw RLMException(@"Invalid property name '%@' for class '%@'.", propertyName, className);
+        }
+        [propertyNames removeObjectForKey:propertyName];
+    }
+    [propertyNames addEntriesFromDictionary:fieldMapping];
+
+    struct ImportedProperty {
+        RLMProperty *prop;
+        realm::ColKey column;
+        size_t index;
+    };
+    RLMProperty *primaryKey = objectSchema.primaryKeyProperty;
+    std::string primaryKeyField;
+    std::unordered_map<std::string, ImportedProperty> properties;
+    std::vector<RLMProperty *> indexedProperties;
+    for (NSString *field in propertyNames) {
+        RLMProperty *prop = objectSchema[propertyNames[field]];
+        if (prop == primaryKey) {
+            primaryKeyField = field.UTF8String;
+        }
+        else if (prop.type != RLMPropertyTypeLinkingObjects) {
+            properties[field.UTF8String] = {prop, info.tableColumn(prop), indexedProperties.size()};
+            indexedProperties.push_back(prop);
+        }
+    }
+    // Newly created objects get the same default values for the properties a
+    // document doesn't have as they would from -[RLMRealm createObject:]
+    NSDictionary *defaultValues = RLMDefaultValuesForObjectSchema(objectSchema);
+    std::vector<bool> imported;
+    if (primaryKey && primaryKeyField.empty()) {
+        @throw RLMException(@"No document field is mapped to the primary key property '%@.%@'.",
+                            className, primaryKey.name);
+    }
+
+    return RLMTranslateError([&] {
+        auto table = info.table();
+        std::string buffer;
+        for (auto& value : documents) {
+            if (value.type() != realm::bson::Bson::Type::Document) {
+                @throw RLMException(@"Invalid value '%@' to import as '%@': value is not a document.",
+                                    RLMConvertBsonToRLMBSON(value), className);
+            }
+            auto& document = static_cast<const realm::bson::BsonDocument&>(value);
+
+            realm::Obj obj;
+            bool created = true;
+            if (primaryKey) {
+                realm::util::Optional<realm::Mixed> key;
+                for (auto it = document.begin(); it != document.end(); ++it) {
+                    const auto& entry = (*it);
+                    if (entry.first == primaryKeyField) {
+                        key = bsonToMixed(entry.second, primaryKey.type, primaryKey.optional, buffer);
+                        if (!key) {
+                            RLMThrowTypeError(RLMConvertBsonToRLMBSON(entry.second), objectSchema, primaryKey);
+                        }
+                        break;
+                    }
+                }
+                if (!key) {
+                    @throw RLMException(@"Document is missing the field '%s' for the primary key property '%@.%@'.",
+                                        primaryKeyField.c_str(), className, primaryKey.name);
+                }
+                if (auto objKey = table->find_primary_key(*key)) {
+                    obj = table->get_object(objKey);
+                    created = false;
+                }
+                else {
+                    obj = table->create_object_with_primary_key(*key);
+                }
+            }
+            else {
+                obj = table->create_object();
+            }
+
+            // Collections, links and values which need to be coerced to the
+            // property's type are set through an accessor, which is only
+            // created for documents which contain such a value
+            RLMObjectBase *accessor;
+            imported.assign(indexedProperties.size(), false);
+            for (auto it = document.begin(); it != document.end(); ++it) {
+                const auto& entry = (*it);
+                auto field = properties.find(entry.first);
+                if (field == properties.end()) {
+                    continue;
+                }
+                auto& [prop, column, index] = field->second;
+                imported[index] = true;
+                realm::util::Optional<realm::Mixed> mixed;
+                if (!prop.collection) {
+                    mixed = bsonToMixed(entry.second, prop.type, prop.optional, buffer);
+                    // The accessor would silently round or truncate numbers
+                    // which can't be stored exactly
+                    if (!mixed && isNumber(prop.type) && isNumber(entry.second.type())) {
+                        RLMThrowTypeError(RLMConvertBsonToRLMBSON(entry.second), objectSchema, prop);
+                    }
+                }
+                if (mixed) {
+                    if (created || obj.get_any(column) != *mixed) {
+                        obj.set_any(column, *mixed);
+                    }
+                }
+                else {
+                    if (!accessor) {
+                        accessor = RLMCreateObjectAccessor(info, realm::Obj(obj));
+                    }
+                    RLMDynamicSet(accessor, prop, RLMConvertBsonToRLMBSON(entry.second));
+                }
+            }
+
+            if (!created) {
+                continue;
+            }
+            for (size_t i = 0; i < indexedProperties.size(); ++i) {
+                if (imported[i]) {
+                    continue;
+                }
+                RLMProperty *prop = indexedProperties[i];
+                if (id defaultValue = defaultValues[prop.name]) {
+                    if (!accessor) {
+                        accessor = RLMCreateObjectAccessor(info, realm::Obj(obj));
+                    }
+                    RLMDynamicSet(accessor, prop, defaultValue);
+                }
+                else if (!prop.optional && !prop.collection && prop.type != RLMPropertyTypeAny) {
+                    @throw RLMException(@"Missing value for property '%@.%@'", className, prop.name);
+                }
+            }
+        }
+        return static_cast<NSUInteger>(documents.size());
+    });
+}
+
 @implementation RLMMongoCollection
 
 static realm::bson::BsonDocument toBsonDocument(id<RLMBSON> bson) {
@@ -127,13 +659,37 @@ static realm::bson::BsonArray toBsonArray(id<RLMBSON> bson) {
 - (void)findWhere:(NSDictionary<NSString *, id<RLMBSON>> *)document
           options:(RLMFindOptions *)options
        completion:(RLMMongoFindBlock)completion {
-    self.collection.find(toBsonDocument(document), [options _findOptions],
-                         [completion](realm::util::Optional<realm::bson::BsonArray> documents,
-                                      realm::util::Optional<realm::app::AppError> error) {
+    auto filter = toBsonDocument(document);
+    auto findOptions = [options _findOptions];
+    auto makeKey = [&] {
+        std::stringstream s;
+        s << "find\n" << _user._syncUser->identity() << "\n" << self.serviceName.UTF8String
+          << "\n" << self.databaseName.UTF8String << "\n" << self.name.UTF8String
+          << "\n" << realm::bson::Bson(filter) << "\n" << findOptions.limit.value_or(0);
+        if (findOptions.projection_bson) {
+            s << "\n" << realm::bson::Bson(*findOptions.projection_bson);
+        }
+        if (findOptions.sort_bson) {
+            s << "\n" << realm::bson::Bson(*findOptions.sort_bson);
+        }
+        return s.str();
+    };
+    auto collection = self.collection;
+    _user.app._responseCache->perform(makeKey, [completion](const realm::util::Optional<realm::app::AppError>& error,
+                                                            const realm::util::Optional<realm::bson::Bson>& documents) {
         if (error) {
             return completion(nil, RLMAppErrorToNSError(*error));
         }
         completion((NSArray<NSDictionary<NSString *, id<RLMBSON>> *> *)RLMConvertBsonToRLMBSON(*documents), nil);
+    }, [&](RLMAppResponseCache::Callback callback) {
+        collection.find(filter, findOptions,
+                        [callback = std::move(callback)](realm::util::Optional<realm::bson::BsonArray> documents,
+                                                         realm::util::Optional<realm::app::AppError> error) {
+            if (error) {
+                return callback(error, realm::util::none);
+            }
+            callback(realm::util::none, realm::bson::Bson(std::move(*documents)));
+        });
     });
 }
 
@@ -142,6 +698,166 @@ static realm::bson::BsonArray toBsonArray(id<RLMBSON> bson) {
     [self findWhere:document options:[[RLMFindOptions alloc] init] completion:completion];
 }
 
+// `$gt` only matches values in the same BSON comparison bracket as its operand,
+// so a page query after an _id of one type silently skips _ids of other types.
+static int idTypeBracket(realm::bson::Bson const& value) {
+    using Type = realm::bson::Bson::Type;
+    switch (value.type()) {
+        case Type::Int32:
+        case Type::Int64:
+        case Type::Double:
+        case Type::Decimal128:
+            return static_cast<int>(Type::Double);
+        case Type::Uuid:
+            return static_cast<int>(Type::Binary);
+        default:
+            return static_cast<int>(value.type());
+    }
+}
+
+// Called once the last page has been read. Reports an error rather than
+// silently ending early if the largest matching _id is of a different type
+// than the last _id reached.
+static void finishFindPages(realm::app::MongoCollection collection, realm::bson::BsonDocument filter,
+                            realm::bson::Bson lastId, RLMMongoFindPagesCompletionBlock completion) {
+    realm::app::MongoCollection::FindOptions options;
+    options.limit = 1;
+    options.projection_bson = realm::bson::BsonDocument{{"_id", 1}};
+    options.sort_bson = realm::bson::BsonDocument{{"_id", -1}};
+    collection.find(filter, options,
+                    [=](realm::util::Optional<realm::bson::BsonArray> documents,
+                        realm::util::Optional<realm::app::AppError> error) {
+        if (error) {
+            return completion(RLMAppErrorToNSError(*error));
+        }
+        if (documents->empty()) {
+            return completion(nil);
+        }
+        auto maxId = realm::bson::BsonDocument(documents->front())["_id"];
+        if (idTypeBracket(maxId) != idTypeBracket(lastId)) {
+            return completion([NSError errorWithDomain:RLMAppErrorDomain code:RLMAppErrorUnknown
+                                              userInfo:@{NSLocalizedDescriptionKey:
+                @"Paginated find operations require the _id of every matching document to be of the same type. "
+                @"Some documents were not returned."}]);
+        }
+        completion(nil);
+    });
+}
+
+static void findPage(realm::app::MongoCollection collection, realm::bson::BsonDocument filter,
+                     realm::util::Optional<realm::bson::Bson> lastId, int64_t remaining, int64_t pageSize,
+                     realm::app::MongoCollection::FindOptions options,
+                     RLMMongoFindPageBlock pageBlock, RLMMongoFindPagesCompletionBlock completion) {
+    auto query = filter;
+    if (lastId) {
+        query = realm::bson::BsonDocument{{"$and", realm::bson::BsonArray{
+            filter, realm::bson::BsonDocument{{"_id", realm::bson::BsonDocument{{"$gt", *lastId}}}}
+        }}};
+    }
+    int64_t limit = remaining < 0 ? pageSize : std::min(pageSize, remaining);
+    options.limit = limit;
+    collection.find(query, options,
+                    [=](realm::util::Optional<realm::bson::BsonArray> documents,
+                        realm::util::Optional<realm::app::AppError> error) mutable {
+        if (error) {
+            return completion(RLMAppErrorToNSError(*error));
+        }
+        int64_t count = static_cast<int64_t>(documents->size());
+        if (count == 0) {
+            if (lastId) {
+                return finishFindPages(collection, filter, *lastId, completion);
+            }
+            return completion(nil);
+        }
+
+        auto next = realm::bson::BsonDocument(documents->back())["_id"];
+        auto page = (NSArray<NSDictionary<NSString *, id<RLMBSON>> *> *)RLMConvertBsonToRLMBSON(*documents);
+        documents = realm::util::none;
+        if (!pageBlock(page)) {
+            return completion(nil);
+        }
+
+        if (remaining >= 0) {
+            remaining -= count;
+        }
+        if (remaining == 0) {
+            return completion(nil);
+        }
+        if (count < limit) {
+            // The first page has no _id bound, so it can't have skipped anything
+            if (lastId) {
+                return finishFindPages(collection, filter, next, completion);
+            }
+            return completion(nil);
+        }
+        findPage(collection, filter, next, remaining, pageSize, options, pageBlock, completion);
+    });
+}
+
+- (void)findWhere:(NSDictionary<NSString *, id<RLMBSON>> *)document
+          options:(RLMFindOptions *)options
+         pageSize:(NSUInteger)pageSize
+        pageBlock:(RLMMongoFindPageBlock)pageBlock
+       completion:(RLMMongoFindPagesCompletionBlock)completion {
+    if (pageSize == 0) {
+        @throw RLMException(@"Page size must be greater than zero.");
+    }
+    if (options.sort) {
+        @throw RLMException(@"Paginated find operations are ordered by _id and cannot be sorted.");
+    }
+
+    auto findOptions = [options _findOptions];
+    if (findOptions.projection_bson) {
+        (*findOptions.projection_bson)["_id"] = 1;
+    }
+    findOptions.sort_bson = realm::bson::BsonDocument{{"_id", 1}};
+    int64_t remaining = findOptions.limit && *findOptions.limit > 0 ? *findOptions.limit : -1;
+    findPage(self.collection, toBsonDocument(document), realm::util::none, remaining,
+             static_cast<int64_t>(pageSize), findOptions, pageBlock, completion);
+}
+
+- (void)importDocumentsWhere:(NSDictionary<NSString *, id<RLMBSON>> *)document
+                     options:(RLMFindOptions *)options
+               configuration:(RLMRealmConfiguration *)configuration
+                   className:(NSString *)className
+                fieldMapping:(NSDictionary<NSString *, NSString *> *)fieldMapping
+                  completion:(RLMMongoCountBlock)completion {
+    configuration = [configuration copy];
+    fieldMapping = [fieldMapping copy];
+    self.collection.find(toBsonDocument(document), [options _findOptions],
+                         [=](realm::util::Optional<realm::bson::BsonArray> documents,
+                             realm::util::Optional<realm::app::AppError> error) {
+        if (error) {
+            return completion(0, RLMAppErrorToNSError(*error));
+        }
+
+        // This is called on the queue which delivers every App response, so
+        // opening the Realm (which may run a migration) and writing the
+        // objects is done on another queue to avoid blocking other requests
+        auto sharedDocuments = std::make_shared<realm::bson::BsonArray>(std::move(*documents));
+        dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+            NSError *importError;
+            NSUInteger count = 0;
+            @autoreleasepool {
+                RLMRealm *realm = [RLMRealm realmWithConfiguration:configuration error:&importError];
+                if (realm) {
+                    [realm beginWriteTransaction];
+                    @try {
+                        count = RLMImportBsonDocuments(realm, className, *sharedDocuments, fieldMapping);
+                        [realm commitWriteTransaction:&importError];
+                    }
+                    @catch (NSException *e) {
+                        [realm cancelWriteTransaction];
+                        importError = [NSError errorWithDomain:RLMErrorDomain code:RLMErrorFail
+                                                      userInfo:@{NSLocalizedDescriptionKey: e.reason}];
+                    }
+                }
+            }
+            completion(importError ? 0 : count, importError);
+        });
+    });
+}
+
 - (void)findOneDocumentWhere:(NSDictionary<NSString *, id<RLMBSON>> *)document
                      options:(RLMFindOptions *)options
                   completion:(RLMMongoFindOneBlock)completion {
@@ -192,6 +908,102 @@ static realm::bson::BsonArray toBsonArray(id<RLMBSON> bson) {
     });
 }
 
+// Sends the next chunk of documents unless every chunk has been sent or a
+// chunk has failed to insert. Each completed request sends the next chunk,
+// so the number of requests in flight stays at the number initially sent.
+static void sendNextChunk(std::shared_ptr<ChunkedInsert> insert) {
+    NSUInteger chunk;
+    {
+        std::lock_guard<std::mutex> lock(insert->mutex);
+        if (insert->error || insert->nextChunk == insert->chunkCount) {
+            return;
+        }
+        chunk = insert->nextChunk++;
+        ++insert->inFlight;
+    }
+
+    NSUInteger start = chunk * insert->chunkSize;
+    NSRange range = NSMakeRange(start, std::min(insert->chunkSize, insert->documents.count - start));
+    insert->collection.insert_many(toBsonArray([insert->documents subarrayWithRange:range]),
+                                   [insert, chunk, count = range.length](std::vector<realm::bson::Bson> insertedIds,
+                                                                         realm::util::Optional<realm::app::AppError> error) {
+        bool finished;
+        {
+            std::lock_guard<std::mutex> lock(insert->mutex);
+            --insert->inFlight;
+            if (error) {
+                if (!insert->error) {
+                    insert->error = RLMAppErrorToNSError(*error);
+                }
+            }
+            else {
+                NSMutableArray *ids = [[NSMutableArray alloc] initWithCapacity:insertedIds.size()];
+                for (auto& objectId : insertedIds) {
+                    [ids addObject:RLMConvertBsonToRLMBSON(objectId)];
+                }
+                insert->insertedIds[chunk] = ids;
+                insert->insertedCount += count;
+                if (auto progressBlock = insert->progressBlock) {
+                    // Enqueued while holding the lock so that the counts are
+                    // reported in order
+                    NSUInteger insertedCount = insert->insertedCount, total = insert->documents.count;
+                    dispatch_async(insert->callbackQueue, ^{
+                        progressBlock(insertedCount, total);
+                    });
+                }
+            }
+            finished = insert->inFlight == 0 && (insert->error || insert->nextChunk == insert->chunkCount);
+        }
+        if (finished) {
+            if (insert->progressBlock) {
+                dispatch_async(insert->callbackQueue, ^{
+                    insert->completion(insert->insertedIds, insert->error);
+                });
+            }
+            else {
+                insert->completion(insert->insertedIds, insert->error);
+            }
+        }
+        else {
+            sendNextChunk(insert);
+        }
+    });
+}
+
+- (void)insertManyDocuments:(NSArray<NSDictionary<NSString *, id<RLMBSON>> *> *)documents
+                  chunkSize:(NSUInteger)chunkSize
+      maxConcurrentRequests:(NSUInteger)maxConcurrentRequests
+              progressBlock:(RLMMongoInsertManyProgressBlock)progressBlock
+                 completion:(RLMMongoInsertManyChunksBlock)completion {
+    if (chunkSize == 0) {
+        @throw RLMException(@"Chunk size must be greater than zero.");
+    }
+    if (maxConcurrentRequests == 0) {
+        @throw RLMException(@"Maximum concurrent requests must be greater than zero.");
+    }
+
+    auto insert = std::make_shared<ChunkedInsert>(self.collection);
+    insert->documents = [documents copy];
+    insert->chunkSize = chunkSize;
+    insert->chunkCount = (documents.count + chunkSize - 1) / chunkSize;
+    insert->progressBlock = progressBlock;
+    insert->completion = completion;
+    if (progressBlock) {
+        insert->callbackQueue = dispatch_queue_create("io.realm.mongo.insertMany", DISPATCH_QUEUE_SERIAL);
+    }
+    insert->insertedIds = [[NSMutableArray alloc] initWithCapacity:insert->chunkCount];
+    for (NSUInteger i = 0; i < insert->chunkCount; ++i) {
+        [insert->insertedIds addObject:@[]];
+    }
+
+    if (insert->chunkCount == 0) {
+        return completion(@[], nil);
+    }
+    for (NSUInteger i = 0; i < std::min(maxConcurrentRequests, insert->chunkCount); ++i) {
+        sendNextChunk(insert);
+    }
+}
+
 - (void)aggregateWithPipeline:(NSArray<NSDictionary<NSString *, id<RLMBSON>> *> *)pipeline
                    completion:(RLMMongoFindBlock)completion {
     self.collection.aggregate(toBsonArray(pipeline),
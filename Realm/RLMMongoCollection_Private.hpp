@@ -18,6 +18,8 @@
 
 #import <Realm/RLMMongoCollection.h>
 
+#import <realm/object-store/util/bson/bson.hpp>
+
 NS_ASSUME_NONNULL_BEGIN
 
 @class RLMUser;
@@ -43,4 +45,15 @@ NS_ASSUME_NONNULL_BEGIN
 
 @end
 
+@class RLMRealm;
+
+// Write each of the documents to `realm` as an object of the given class,
+// updating existing objects which have the same primary key. Document fields
+// are renamed using `fieldMapping` (field name to property name) and fields
+// without a matching property are skipped. Must be called within a write
+// transaction. Returns the number of objects which were created or updated.
+NSUInteger RLMImportBsonDocuments(RLMRealm *realm, NSString *className,
+                                  const realm::bson::BsonArray& documents,
+                                  NSDictionary<NSString *, NSString *> *_Nullable fieldMapping);
+
 NS_ASSUME_NONNULL_END
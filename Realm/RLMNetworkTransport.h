@@ -116,6 +116,44 @@ typedef void(^RLMNetworkTransportCompletionBlock)(RLMResponse *);
 /// request/response handling.
 @interface RLMNetworkTransport : NSObject<RLMNetworkTransport>
 
+/**
+ The maximum number of simultaneous connections to each host which will be
+ opened by this transport.
+
+ Requests are sent over a single long-lived `NSURLSession` for the lifetime of
+ the transport, so connections are kept alive and reused between requests, and
+ requests to servers which support HTTP/2 are multiplexed over a shared
+ connection.
+ */
+@property (nonatomic, readonly) NSUInteger maximumConnectionsPerHost;
+
+/**
+ Request bodies larger than this number of bytes are compressed with gzip before
+ being sent. The default value of 0 disables request compression.
+
+ Compressed request bodies are only accepted by servers which support a
+ `Content-Encoding` of `gzip` on requests. Responses compressed with gzip or
+ deflate are always decompressed transparently, regardless of this setting.
+ */
+@property (atomic) NSUInteger requestCompressionThreshold;
+
+/// The total number of request body bytes sent by this transport, after compression.
+@property (nonatomic, readonly) uint64_t bytesSent;
+
+/// The total number of response body bytes received by this transport.
+@property (nonatomic, readonly) uint64_t bytesReceived;
+
+/// Creates a transport which uses the system default connection limit.
+- (instancetype)init;
+
+/**
+ Creates a transport which opens at most the given number of simultaneous
+ connections to each host.
+
+ @param maximumConnectionsPerHost The maximum number of connections per host.
+ */
+- (instancetype)initWithMaximumConnectionsPerHost:(NSUInteger)maximumConnectionsPerHost;
+
 /**
  Sends a request to a given endpoint.
 
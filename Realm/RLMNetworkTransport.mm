@@ -27,6 +27,11 @@
 #import <realm/object-store/sync/generic_network_transport.hpp>
 #import <realm/util/scope_exit.hpp>
 
+#import <atomic>
+#import <mutex>
+#import <unordered_map>
+#import <zlib.h>
+
 using namespace realm;
 
 static_assert((int)RLMHTTPMethodGET        == (int)app::HttpMethod::get);
@@ -37,8 +42,12 @@ static_assert((int)RLMHTTPMethodDELETE     == (int)app::HttpMethod::del);
 
 #pragma mark RLMSessionDelegate
 
-@interface RLMSessionDelegate <NSURLSessionDelegate> : NSObject
-+ (instancetype)delegateWithCompletion:(RLMNetworkTransportCompletionBlock)completion;
+// A single delegate is shared by all of the requests made through a transport's
+// session, so the response data and completion block are tracked per task
+@interface RLMSessionDelegate : NSObject <NSURLSessionDataDelegate>
+- (void)addTask:(NSURLSessionTask *)task completion:(RLMNetworkTransportCompletionBlock)completion;
+- (uint64_t)bytesSent;
+- (uint64_t)bytesReceived;
 @end
 
 NSString * const RLMHTTPMethodToNSString[] = {
@@ -52,14 +61,95 @@ NSString * const RLMHTTPMethodToNSString[] = {
 @implementation RLMRequest
 @end
 
-@implementation RLMResponse
+@implementation RLMResponse {
+    NSString *_body;
+}
+
+- (NSString *)body {
+    if (!_body && _rawBody) {
+        _body = [[NSString alloc] initWithBytes:_rawBody->data() length:_rawBody->size()
+                                       encoding:NSUTF8StringEncoding];
+        _rawBody.reset();
+    }
+    return _body;
+}
+
+- (void)setBody:(NSString *)body {
+    _body = body;
+    _rawBody.reset();
+}
+
 @end
 
+std::string RLMResponseTakeBody(RLMResponse *response) {
+    if (response->_rawBody) {
+        std::string body = std::move(*response->_rawBody);
+        response->_rawBody.reset();
+        return body;
+    }
+    NSString *body = response.body;
+    return body ? body.UTF8String : "";
+}
+
 @interface RLMEventSessionDelegate <NSURLSessionDelegate> : NSObject
 + (instancetype)delegateWithEventSubscriber:(RLMEventSubscriber *)subscriber;
 @end;
 
-@implementation RLMNetworkTransport
+// Returns the data compressed in the gzip format, or nil if compression failed
+static NSData *RLMGzipCompress(NSData *data) {
+    z_stream stream{};
+    if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        return nil;
+    }
+    auto out = [NSMutableData dataWithLength:deflateBound(&stream, static_cast<uLong>(data.length))];
+    stream.next_in = static_cast<Bytef *>(const_cast<void *>(data.bytes));
+    stream.avail_in = static_cast<uInt>(data.length);
+    stream.next_out = static_cast<Bytef *>(out.mutableBytes);
+    stream.avail_out = static_cast<uInt>(out.length);
+    int result = deflate(&stream, Z_FINISH);
+    deflateEnd(&stream);
+    if (result != Z_STREAM_END) {
+        return nil;
+    }
+    out.length = stream.total_out;
+    return out;
+}
+
+@implementation RLMNetworkTransport {
+    NSURLSession *_session;
+    RLMSessionDelegate *_delegate;
+}
+
+- (instancetype)init {
+    return [self initWithMaximumConnectionsPerHost:0];
+}
+
+- (instancetype)initWithMaximumConnectionsPerHost:(NSUInteger)maximumConnectionsPerHost {
+    if (self = [super init]) {
+        auto config = NSURLSessionConfiguration.defaultSessionConfiguration;
+        if (maximumConnectionsPerHost > 0) {
+            config.HTTPMaximumConnectionsPerHost = (NSInteger)maximumConnectionsPerHost;
+        }
+        _maximumConnectionsPerHost = (NSUInteger)config.HTTPMaximumConnectionsPerHost;
+        _delegate = [RLMSessionDelegate new];
+        _session = [NSURLSession sessionWithConfiguration:config
+                                                 delegate:_delegate delegateQueue:nil];
+    }
+    return self;
+}
+
+- (uint64_t)bytesSent {
+    return _delegate.bytesSent;
+}
+
+- (uint64_t)bytesReceived {
+    return _delegate.bytesReceived;
+}
+
+- (void)dealloc {
+    // The session retains its delegate until it is invalidated
+    [_session finishTasksAndInvalidate];
+}
 
 - (void)sendRequestToServer:(RLMRequest *) request
                  completion:(RLMNetworkTransportCompletionBlock)completionBlock; {
@@ -67,22 +157,31 @@ NSString * const RLMHTTPMethodToNSString[] = {
     NSURL *requestURL = [[NSURL alloc] initWithString: request.url];
     NSMutableURLRequest *urlRequest = [NSMutableURLRequest requestWithURL:requestURL];
     urlRequest.HTTPMethod = RLMHTTPMethodToNSString[request.method];
+    bool compressed = false;
     if (![urlRequest.HTTPMethod isEqualToString:@"GET"]) {
-        urlRequest.HTTPBody = [request.body dataUsingEncoding:NSUTF8StringEncoding];
+        NSData *body = [request.body dataUsingEncoding:NSUTF8StringEncoding];
+        NSUInteger threshold = self.requestCompressionThreshold;
+        if (threshold > 0 && body.length > threshold) {
+            if (NSData *compressedBody = RLMGzipCompress(body)) {
+                body = compressedBody;
+                compressed = true;
+            }
+        }
+        urlRequest.HTTPBody = body;
     }
     urlRequest.timeoutInterval = request.timeout;
 
     for (NSString *key in request.headers) {
         [urlRequest addValue:request.headers[key] forHTTPHeaderField:key];
     }
-    id delegate = [RLMSessionDelegate delegateWithCompletion:completionBlock];
-    auto session = [NSURLSession sessionWithConfiguration:NSURLSessionConfiguration.defaultSessionConfiguration
-                                                 delegate:delegate delegateQueue:nil];
+    if (compressed) {
+        [urlRequest setValue:@"gzip" forHTTPHeaderField:@"Content-Encoding"];
+    }
 
-    // Add the request to a task and start it
-    [[session dataTaskWithRequest:urlRequest] resume];
-    // Tell the session to destroy itself once it's done with the request
-    [session finishTasksAndInvalidate];
+    // Add the request to a task on the shared session and start it
+    NSURLSessionDataTask *task = [_session dataTaskWithRequest:urlRequest];
+    [_delegate addTask:task completion:completionBlock];
+    [task resume];
 }
 
 - (NSURLSession *)doStreamRequest:(nonnull RLMRequest *)request
@@ -122,34 +221,80 @@ NSString * const RLMHTTPMethodToNSString[] = {
 
 #pragma mark RLMSessionDelegate
 
+namespace {
+struct RLMSessionTask {
+    std::string body;
+    RLMNetworkTransportCompletionBlock completion;
+};
+} // anonymous namespace
+
 @implementation RLMSessionDelegate {
-    NSData *_data;
-    RLMNetworkTransportCompletionBlock _completionBlock;
+    std::mutex _mutex;
+    std::unordered_map<NSUInteger, RLMSessionTask> _tasks;
+    std::atomic<uint64_t> _bytesSent;
+    std::atomic<uint64_t> _bytesReceived;
 }
 
-+ (instancetype)delegateWithCompletion:(RLMNetworkTransportCompletionBlock)completion {
-    RLMSessionDelegate *delegate = [RLMSessionDelegate new];
-    delegate->_completionBlock = completion;
-    return delegate;
+- (uint64_t)bytesSent {
+    return _bytesSent.load();
+}
+
+- (uint64_t)bytesReceived {
+    return _bytesReceived.load();
+}
+
+- (void)addTask:(NSURLSessionTask *)task completion:(RLMNetworkTransportCompletionBlock)completion {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _tasks[task.taskIdentifier] = {{}, completion};
 }
 
 - (void)URLSession:(__unused NSURLSession *)session
-          dataTask:(__unused NSURLSessionDataTask *)dataTask
+          dataTask:(NSURLSessionDataTask *)dataTask
+didReceiveResponse:(NSURLResponse *)response
+ completionHandler:(void (^)(NSURLSessionResponseDisposition))completionHandler {
+    // Size the body buffer up front when the server told us how large it is
+    // so that it doesn't need to be reallocated as data arrives
+    if (response.expectedContentLength > 0) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _tasks.find(dataTask.taskIdentifier);
+        if (it != _tasks.end()) {
+            it->second.body.reserve(static_cast<size_t>(response.expectedContentLength));
+        }
+    }
+    completionHandler(NSURLSessionResponseAllow);
+}
+
+- (void)URLSession:(__unused NSURLSession *)session
+          dataTask:(NSURLSessionDataTask *)dataTask
     didReceiveData:(NSData *)data {
-    if (!_data) {
-        _data = data;
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _tasks.find(dataTask.taskIdentifier);
+    if (it == _tasks.end()) {
         return;
     }
-    if (![_data respondsToSelector:@selector(appendData:)]) {
-        _data = [_data mutableCopy];
-    }
-    [(id)_data appendData:data];
+    auto& body = it->second.body;
+    [data enumerateByteRangesUsingBlock:^(const void *bytes, NSRange range, BOOL *) {
+        body.append(static_cast<const char *>(bytes), range.length);
+    }];
 }
 
 - (void)URLSession:(__unused NSURLSession *)session
               task:(NSURLSessionTask *)task
 didCompleteWithError:(NSError *)error
 {
+    RLMSessionTask state;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _tasks.find(task.taskIdentifier);
+        if (it == _tasks.end()) {
+            return;
+        }
+        state = std::move(it->second);
+        _tasks.erase(it);
+    }
+    _bytesSent += static_cast<uint64_t>(task.countOfBytesSent);
+    _bytesReceived += static_cast<uint64_t>(task.countOfBytesReceived);
+
     RLMResponse *response = [RLMResponse new];
     NSHTTPURLResponse *httpResponse = (NSHTTPURLResponse *) task.response;
     response.headers = httpResponse.allHeaderFields;
@@ -158,12 +303,12 @@ didCompleteWithError:(NSError *)error
     if (error) {
         response.body = error.localizedDescription;
         response.customStatusCode = error.code;
-        return _completionBlock(response);
+        return state.completion(response);
     }
 
-    response.body = [[NSString alloc] initWithData:_data encoding:NSUTF8StringEncoding];
+    response->_rawBody = std::move(state.body);
 
-    _completionBlock(response);
+    state.completion(response);
 }
 
 @end
@@ -18,6 +18,9 @@
 
 #import "RLMNetworkTransport.h"
 
+#import <optional>
+#import <string>
+
 namespace realm {
 namespace app {
 struct GenericEventSubscriber;
@@ -33,6 +36,18 @@ struct Request;
 
 @end
 
+@interface RLMResponse () {
+@public
+    // The body bytes as received by RLMNetworkTransport, which are only
+    // converted to an NSString if `body` is read
+    std::optional<std::string> _rawBody;
+}
+@end
+
+// Returns the body of the response, moving the received bytes out of the
+// response rather than copying them if they were never converted to a string
+std::string RLMResponseTakeBody(RLMResponse *response);
+
 @interface RLMNetworkTransport()
 
 - (RLMRequest *)RLMRequestFromRequest:(realm::app::Request)request;
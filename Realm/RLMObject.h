@@ -743,6 +743,38 @@ typedef void (^RLMObjectChangeBlock)(BOOL deleted,
  */
 - (instancetype)thaw;
 
+#pragma mark - Link Paths
+
+/**
+ Returns the value at the end of a key path which follows links to single objects.
+
+ This is equivalent to reading each property in turn, such as `self.dog.owner.name`
+ for the key path `@"dog.owner.name"`, but does not create an object for each
+ object along the path, which makes it much faster for reading values through
+ several links. Unlike key-value coding, `nil` is returned if any link along the
+ path is `nil`.
+
+ @param linkPath A key path in which every property but the last is a link to a
+                 single object.
+
+ @return The value of the last property in the key path.
+ */
+- (nullable id)valueForLinkPath:(NSString *)linkPath;
+
+#pragma mark - BSON
+
+/**
+ Returns the object's properties encoded as a binary BSON document.
+
+ The values are read directly from the Realm file without creating any
+ intermediate Objective-C objects. Embedded objects are encoded as nested
+ documents and links to other objects as the linked object's primary key, or
+ `null` if it does not have one. Linking objects properties are omitted.
+
+ This method can only be called on managed objects.
+ */
+- (NSData *)bsonDocument;
+
 #pragma mark - Dynamic Accessors
 
 /// :nodoc:
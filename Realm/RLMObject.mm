@@ -88,6 +88,14 @@
 
 #pragma mark - Subscripting
 
+- (id)valueForLinkPath:(NSString *)linkPath {
+    return RLMObjectBaseValueForLinkPath(self, linkPath);
+}
+
+- (NSData *)bsonDocument {
+    return RLMObjectBaseBsonDocument(self);
+}
+
 - (id)objectForKeyedSubscript:(NSString *)key {
     return RLMObjectBaseObjectForKeyedSubscript(self, key);
 }
@@ -21,12 +21,14 @@
 
 #import "RLMAccessor.h"
 #import "RLMArray_Private.hpp"
+#import "RLMBSON_Private.hpp"
 #import "RLMDecimal128.h"
 #import "RLMObjectSchema_Private.hpp"
 #import "RLMObjectStore.h"
 #import "RLMObservation.hpp"
 #import "RLMProperty_Private.h"
 #import "RLMRealm_Private.hpp"
+#import "RLMResults_Private.hpp"
 #import "RLMSchema_Private.h"
 #import "RLMSet_Private.hpp"
 #import "RLMSwiftCollectionBase.h"
@@ -446,6 +448,32 @@ id RLMObjectBaseObjectForKeyedSubscript(RLMObjectBase *object, NSString *key) {
     }
 }
 
+id RLMObjectBaseValueForLinkPath(RLMObjectBase *object, NSString *linkPath) {
+    if (!object) {
+        return nil;
+    }
+
+    if (object->_realm) {
+        return RLMDynamicGetByLinkPath(object, linkPath);
+    }
+    else {
+        return [object valueForKeyPath:linkPath];
+    }
+}
+
+NSData *RLMObjectBaseBsonDocument(RLMObjectBase *object) {
+    if (!object->_realm) {
+        @throw RLMException(@"Only managed objects can be encoded as BSON.");
+    }
+    RLMVerifyAttached(object);
+
+    std::string buffer;
+    RLMTranslateError([&] {
+        RLMAppendObjectBson(buffer, *object->_info, object->_row, nil);
+    });
+    return RLMDataWithBsonBuffer(std::move(buffer));
+}
+
 void RLMObjectBaseSetObjectForKeyedSubscript(RLMObjectBase *object, NSString *key, id obj) {
     if (!object) {
         return;
@@ -522,6 +550,92 @@ id RLMObjectThaw(RLMObjectBase *obj) {
     return resolveObject(obj, obj->_realm.thaw);
 }
 
+static NSArray *resolveObjects(id<NSFastEnumeration> objects, bool freeze) {
+    id enumerable = objects;
+    NSUInteger capacity = [enumerable respondsToSelector:@selector(count)] ? [enumerable count] : 0;
+    NSMutableArray *resolved = [NSMutableArray arrayWithCapacity:capacity];
+    NSMapTable<RLMRealm *, RLMRealm *> *targetRealms
+        = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsObjectPointerPersonality
+                                valueOptions:NSPointerFunctionsStrongMemory];
+
+    __unsafe_unretained RLMRealm *sourceRealm = nil;
+    RLMRealm *targetRealm;
+    RLMClassInfo *sourceInfo = nullptr;
+    RLMClassInfo *targetInfo = nullptr;
+    realm::TableRef targetTable;
+
+    // Importing a row into another Realm looks it up by key in the target
+    // transaction, so this does the same with the table cached for each run
+    // of objects of the same type
+    auto resolve = [&](RLMRealm *realm, RLMClassInfo *info, Class cls, realm::ObjKey key) {
+        if (realm != sourceRealm) {
+            sourceRealm = realm;
+            targetRealm = [targetRealms objectForKey:realm];
+            if (!targetRealm) {
+                targetRealm = freeze ? realm.freeze : realm.thaw;
+                [targetRealms setObject:targetRealm forKey:realm];
+            }
+            sourceInfo = nullptr;
+        }
+        if (info != sourceInfo) {
+            sourceInfo = info;
+            targetInfo = &targetRealm->_info[info->rlmObjectSchema.className];
+            targetTable = targetInfo->table();
+        }
+        if (!targetTable->is_valid(key)) {
+            if (freeze) {
+                @throw RLMException(@"Cannot freeze an object in the same write transaction as it was created in.");
+            }
+            // Keep the position of the deleted object so that the results
+            // can be matched up with the input
+            [resolved addObject:NSNull.null];
+            return;
+        }
+        RLMObjectBase *obj = RLMCreateManagedAccessor(cls, targetInfo);
+        obj->_row = targetTable->get_object(key);
+        RLMInitializeSwiftAccessor(obj, false);
+        [resolved addObject:obj];
+    };
+
+    // Read the keys from results directly rather than creating accessors for
+    // the source objects
+    if ([enumerable isKindOfClass:[RLMResults class]]) {
+        RLMResults *results = enumerable;
+        RLMRealm *realm = results.realm;
+        if (results.type == RLMPropertyTypeObject && realm && realm.frozen != freeze) {
+            RLMClassInfo *info = &realm->_info[results.objectClassName];
+            for (auto key : [results objectKeys]) {
+                resolve(realm, info, info->rlmObjectSchema.accessorClass, key);
+            }
+            return resolved;
+        }
+    }
+
+    for (RLMObjectBase *obj in objects) {
+        if (![obj isKindOfClass:[RLMObjectBase class]]) {
+            @throw RLMException(@"Cannot %@ '%@', which is not a Realm object.", freeze ? @"freeze" : @"thaw", obj);
+        }
+        if (!obj->_realm && !obj.isInvalidated) {
+            @throw RLMException(@"Unmanaged objects cannot be frozen.");
+        }
+        RLMVerifyAttached(obj);
+        if (obj->_realm.frozen == freeze) {
+            [resolved addObject:obj];
+            continue;
+        }
+        resolve(obj->_realm, obj->_info, obj.class, obj->_row.get_key());
+    }
+    return resolved;
+}
+
+NSArray *RLMFreezeObjects(id<NSFastEnumeration> objects) {
+    return resolveObjects(objects, true);
+}
+
+NSArray *RLMThawObjects(id<NSFastEnumeration> objects) {
+    return resolveObjects(objects, false);
+}
+
 id RLMValidatedValueForProperty(id object, NSString *key, NSString *className) {
     @try {
         return [object valueForKey:key];
@@ -64,6 +64,37 @@ FOUNDATION_EXTERN RLMObjectSchema * _Nullable RLMObjectBaseObjectSchema(RLMObjec
  */
 FOUNDATION_EXTERN id _Nullable RLMObjectBaseObjectForKeyedSubscript(RLMObjectBase * _Nullable object, NSString *key);
 
+/**
+ Returns the value at the end of a key path of links to single objects.
+
+ Unlike key-value coding, this does not create an object for each object along
+ the path, and returns `nil` if any link along the path is `nil`.
+
+ @warning  This function is useful only in specialized circumstances, for example, when building components
+           that integrate with Realm. If you are simply building an app on Realm, it is
+           recommended to use `-[RLMObject valueForLinkPath:]` or `Object.value(forLinkPath:)`.
+
+ @param object   An `RLMObjectBase` obtained via a Swift `Object` or `RLMObject`.
+ @param linkPath A key path such as `@"dog.owner.name"`, in which every property but the
+                 last must be a link to a single object.
+
+ @return The value of the last property in the key path.
+ */
+FOUNDATION_EXTERN id _Nullable RLMObjectBaseValueForLinkPath(RLMObjectBase * _Nullable object, NSString *linkPath);
+
+/**
+ Returns the object's properties encoded as a binary BSON document.
+
+ @warning  This function is useful only in specialized circumstances, for example, when building components
+           that integrate with Realm. If you are simply building an app on Realm, it is
+           recommended to use `-[RLMObject bsonDocument]` or `Object.bsonDocument()`.
+
+ @param object   A managed `RLMObjectBase` obtained via a Swift `Object` or `RLMObject`.
+
+ @return The BSON document.
+ */
+FOUNDATION_EXTERN NSData *RLMObjectBaseBsonDocument(RLMObjectBase *object);
+
 /**
  Sets a value for a key on the object.
 
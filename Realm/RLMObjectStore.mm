@@ -214,6 +214,7 @@ RLMResults *RLMGetObjects(__unsafe_unretained RLMRealm *const realm,
     }
 
     if (predicate) {
+        RLMVerifyNoPendingLazyMigration(info, predicate);
         realm::Query query = RLMPredicateToQuery(predicate, info.rlmObjectSchema, realm.schema, realm.group);
         return [RLMResults resultsWithObjectInfo:info
                                          results:realm::Results(realm->_realm, std::move(query))];
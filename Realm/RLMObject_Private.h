@@ -78,6 +78,11 @@ FOUNDATION_EXTERN id RLMObjectFreeze(RLMObjectBase *obj) NS_RETURNS_RETAINED;
 
 FOUNDATION_EXTERN id RLMObjectThaw(RLMObjectBase *obj);
 
+// Freeze or thaw each of the objects, looking up the target Realm and type
+// once for each run of objects from the same Realm and of the same type
+FOUNDATION_EXTERN NSArray *RLMFreezeObjects(id<NSFastEnumeration> objects);
+FOUNDATION_EXTERN NSArray *RLMThawObjects(id<NSFastEnumeration> objects);
+
 // Gets an object identifier suitable for use with Combine. This value may
 // change when an unmanaged object is added to the Realm.
 FOUNDATION_EXTERN uint64_t RLMObjectBaseGetCombineId(RLMObjectBase *);
@@ -35,5 +35,12 @@ extern NSString * const RLMUnsupportedTypesFoundInPropertyComparisonException;
 realm::Query RLMPredicateToQuery(NSPredicate *predicate, RLMObjectSchema *objectSchema,
                                  RLMSchema *schema, realm::Group &group);
 
+// Throw if any of the key paths used to filter, sort, distinct or aggregate
+// objects of the type reference a property whose lazy migration has not yet
+// completed, as its stored values are not yet valid. Every hop of a key path
+// through a link is checked against the link's target type.
+void RLMVerifyNoPendingLazyMigration(RLMClassInfo& info, NSArray<NSString *> *keyPaths);
+void RLMVerifyNoPendingLazyMigration(RLMClassInfo& info, NSPredicate *predicate);
+
 // return property - throw for invalid column name
 RLMProperty *RLMValidatedProperty(RLMObjectSchema *objectSchema, NSString *columnName);
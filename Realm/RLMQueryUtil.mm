@@ -19,10 +19,13 @@
 #import "RLMQueryUtil.hpp"
 
 #import "RLMAccessor.hpp"
+#import "RLMClassInfo.hpp"
+#import "RLMMigration_Private.h"
 #import "RLMObjectSchema_Private.hpp"
 #import "RLMObject_Private.hpp"
 #import "RLMPredicateUtil.hpp"
 #import "RLMProperty_Private.h"
+#import "RLMRealm_Private.hpp"
 #import "RLMSchema.h"
 #import "RLMUtil.hpp"
 
@@ -1724,8 +1727,93 @@ void QueryBuilder::apply_predicate(NSPredicate *predicate, RLMObjectSchema *obje
                        @"Only support compound, comparison, and constant predicates");
     }
 }
+
+void verifyNoPendingLazyMigration(RLMClassInfo *info, NSPredicate *predicate);
+
+// Throw if the property at any hop of the key path, starting from the type
+// `info`, has a lazy migration which has not yet completed
+RLMClassInfo *verifyNoPendingLazyMigration(RLMClassInfo *info, NSString *keyPath) {
+    for (NSString *component in [keyPath componentsSeparatedByString:@"."]) {
+        RLMProperty *property = info->rlmObjectSchema[component];
+        if (!property) {
+            // Collection operators, and invalid names which are reported when
+            // the query is built
+            return nullptr;
+        }
+        // Opening a Realm registers any pending lazy migrations on the class
+        // info, so the file only needs to be checked if there are some
+        if (REALM_UNLIKELY(info->lazyMigration)) {
+            NSString *className = info->rlmObjectSchema.className;
+            if ([RLMPendingLazyMigrationProperties(info->realm.group, className) containsObject:component]) {
+                @throw RLMException(@"Cannot query, sort or aggregate on property '%@.%@' until its lazy migration has completed.",
+                                    className, component);
+            }
+        }
+        if (!property.objectClassName) {
+            return nullptr;
+        }
+        info = &info->realm->_info[property.objectClassName];
+    }
+    return info;
+}
+
+void verifyNoPendingLazyMigration(RLMClassInfo *info, NSExpression *expression) {
+    switch (expression.expressionType) {
+        case NSKeyPathExpressionType:
+            verifyNoPendingLazyMigration(info, expression.keyPath);
+            break;
+        case NSFunctionExpressionType:
+            verifyNoPendingLazyMigration(info, expression.operand);
+            for (NSExpression *argument in expression.arguments) {
+                verifyNoPendingLazyMigration(info, argument);
+            }
+            break;
+        case NSSubqueryExpressionType: {
+            if (expression.collection.expressionType != NSKeyPathExpressionType) {
+                break;
+            }
+            RLMClassInfo *memberInfo = verifyNoPendingLazyMigration(info, expression.collection.keyPath);
+            if (memberInfo) {
+                // Check the subquery against the collection's member type in
+                // the same form that QueryBuilder applies it
+                NSPredicate *subqueryPredicate = [expression.predicate predicateWithSubstitutionVariables:@{expression.variable: [NSExpression expressionForEvaluatedObject]}];
+                subqueryPredicate = transformPredicate(subqueryPredicate, simplify_self_value_for_key_path_function_expression);
+                verifyNoPendingLazyMigration(memberInfo, subqueryPredicate);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void verifyNoPendingLazyMigration(RLMClassInfo *info, NSPredicate *predicate) {
+    if ([predicate isKindOfClass:[NSCompoundPredicate class]]) {
+        for (NSPredicate *subpredicate in ((NSCompoundPredicate *)predicate).subpredicates) {
+            verifyNoPendingLazyMigration(info, subpredicate);
+        }
+    }
+    else if ([predicate isKindOfClass:[NSComparisonPredicate class]]) {
+        verifyNoPendingLazyMigration(info, ((NSComparisonPredicate *)predicate).leftExpression);
+        verifyNoPendingLazyMigration(info, ((NSComparisonPredicate *)predicate).rightExpression);
+    }
+}
 } // namespace
 
+void RLMVerifyNoPendingLazyMigration(RLMClassInfo& info, NSArray<NSString *> *keyPaths) {
+    for (NSString *keyPath in keyPaths) {
+        verifyNoPendingLazyMigration(&info, keyPath);
+    }
+}
+
+void RLMVerifyNoPendingLazyMigration(RLMClassInfo& info, NSPredicate *predicate) {
+    if (predicate) {
+        @autoreleasepool {
+            verifyNoPendingLazyMigration(&info, predicate);
+        }
+    }
+}
+
 realm::Query RLMPredicateToQuery(NSPredicate *predicate, RLMObjectSchema *objectSchema,
                                  RLMSchema *schema, Group &group)
 {
@@ -19,7 +19,7 @@
 #import <Foundation/Foundation.h>
 #import <Realm/RLMConstants.h>
 
-@class RLMRealmConfiguration, RLMRealm, RLMObject, RLMSchema, RLMMigration, RLMNotificationToken, RLMThreadSafeReference, RLMAsyncOpenTask;
+@class RLMRealmConfiguration, RLMRealm, RLMObject, RLMSchema, RLMMigration, RLMNotificationToken, RLMThreadSafeReference, RLMThreadSafeBatchReference, RLMAsyncOpenTask;
 
 /**
  A callback block for opening Realms asynchronously.
@@ -218,6 +218,35 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (RLMRealm *)thaw;
 
+/**
+ Returns frozen snapshots of each of the given objects.
+
+ This is equivalent to calling `-[RLMObject freeze]` on each object, but the
+ frozen Realm and the type of each object are only looked up once for each run
+ of objects from the same Realm and of the same type, and each object is found
+ in the frozen Realm by its key. Objects which are already frozen are returned
+ as-is.
+
+ @param objects An `NSArray` of managed objects or a Realm collection of objects.
+ @return An array containing the frozen objects in the same order.
+ */
++ (NSArray *)freezeObjects:(id<NSFastEnumeration>)objects;
+
+/**
+ Returns live references to each of the given frozen objects.
+
+ This is equivalent to calling `-[RLMObject thaw]` on each object, but the live
+ Realm is only opened once for each frozen Realm. Objects which are not frozen
+ are returned as-is, and objects which have been deleted in the live Realm are
+ replaced by `NSNull`, so that the returned array always has one element for
+ each of the given objects.
+
+ @param objects An `NSArray` of managed objects or a Realm collection of objects.
+ @return An array containing the live objects, or `NSNull` for deleted objects,
+         in the same order.
+ */
++ (NSArray *)thawObjects:(id<NSFastEnumeration>)objects;
+
 #pragma mark - File Management
 
 /**
@@ -590,6 +619,27 @@ typedef void (^RLMNotificationBlock)(RLMNotification notification, RLMRealm *rea
 - (nullable id)resolveThreadSafeReference:(RLMThreadSafeReference *)reference
 NS_REFINED_FOR_SWIFT;
 
+/**
+ Returns the objects referenced when the `RLMThreadSafeBatchReference` was
+ created, resolved for the current Realm for this thread. Objects which were
+ deleted after the reference was created are omitted.
+
+ The accessor for each object is not created until that element of the returned
+ array is first accessed, and the array must only be used on this Realm's thread.
+
+ @param reference The thread-safe batch reference to resolve in this Realm.
+
+ @warning A `RLMThreadSafeBatchReference` object must be resolved at most once.
+          An exception will be thrown if a reference is resolved more than once.
+
+ @warning Cannot call within a write transaction.
+
+ @note Will refresh this Realm if the source Realm was at a later version than this one.
+
+ @see `+[RLMThreadSafeBatchReference referenceWithObjects:]`
+ */
+- (NSArray<RLMObject *> *)resolveThreadSafeBatchReference:(RLMThreadSafeBatchReference *)reference;
+
 #pragma mark - Adding and Removing Objects from a Realm
 
 /**
@@ -49,6 +49,8 @@
 #import <realm/util/scope_exit.hpp>
 #import <realm/version.hpp>
 
+#import <unordered_map>
+
 #if REALM_ENABLE_SYNC
 #import "RLMSyncManager_Private.hpp"
 #import "RLMSyncSession_Private.hpp"
@@ -95,6 +97,48 @@ BOOL RLMIsRealmCachedAtPath(NSString *path) {
     return RLMGetAnyCachedRealmForPath([path cStringUsingEncoding:NSUTF8StringEncoding]) != nil;
 }
 
+static BOOL RLMCompletePendingMigrations(RLMRealm *realm, RLMRealmConfiguration *configuration,
+                                         NSError **error) {
+    // The schema version of each file at which it was last seen to have no
+    // pending chunked or lazy migrations. Scheduling either requires a schema
+    // version bump, possibly by another process, so the state tables only need
+    // to be read again once the file's schema version has changed.
+    static std::mutex& mutex = *new std::mutex();
+    static auto& checkedVersions = *new std::unordered_map<std::string, uint64_t>();
+
+    auto& sharedRealm = *realm->_realm;
+    const std::string& path = sharedRealm.config().path;
+    bool wasInReadTransaction = sharedRealm.is_in_read_transaction();
+    uint64_t version = ObjectStore::get_schema_version(sharedRealm.read_group());
+    if (!wasInReadTransaction) {
+        sharedRealm.invalidate();
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = checkedVersions.find(path);
+        if (it != checkedVersions.end() && it->second == version) {
+            return YES;
+        }
+    }
+
+    bool hasPendingLazyMigrations = false;
+    if (!RLMRunPendingChunkedMigration(realm, configuration, error)) {
+        return NO;
+    }
+    if (!RLMAttachLazyMigrations(realm, configuration, &hasPendingLazyMigrations, error)) {
+        return NO;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (hasPendingLazyMigrations) {
+        checkedVersions.erase(path);
+    }
+    else {
+        checkedVersions[path] = version;
+    }
+    return YES;
+}
+
 @implementation RLMRealmNotificationToken
 - (void)invalidate {
     [_realm verifyThread];
@@ -454,7 +498,7 @@ REALM_NOINLINE void RLMRealmTranslateException(NSError **error) {
 
     // protects the realm cache and accessors cache
     static std::mutex& initLock = *new std::mutex();
-    std::lock_guard<std::mutex> lock(initLock);
+    std::unique_lock<std::mutex> lock(initLock);
 
     try {
         if (queue) {
@@ -502,7 +546,10 @@ REALM_NOINLINE void RLMRealmTranslateException(NSError **error) {
 
         Realm::MigrationFunction migrationFunction;
         auto migrationBlock = configuration.migrationBlock;
-        if (migrationBlock && configuration.schemaVersion > 0) {
+        NSArray *chunkedMigrationClasses = configuration.chunkedMigrationBlocks.allKeys;
+        NSArray *lazyMigrationProperties = configuration.lazyPropertyMigrationBlocks.allKeys;
+        if ((migrationBlock || chunkedMigrationClasses.count || lazyMigrationProperties.count)
+            && configuration.schemaVersion > 0) {
             migrationFunction = [=](SharedRealm old_realm, SharedRealm realm, Schema& mutableSchema) {
                 RLMSchema *oldSchema = [RLMSchema dynamicSchemaFromObjectStoreSchema:old_realm->schema()];
                 RLMRealm *oldRealm = [RLMRealm realmWithSharedRealm:old_realm schema:oldSchema];
@@ -513,7 +560,10 @@ REALM_NOINLINE void RLMRealmTranslateException(NSError **error) {
                 // are created
                 RLMRealm *newRealm = [RLMRealm realmWithSharedRealm:realm schema:schema.copy];
 
-                [[[RLMMigration alloc] initWithRealm:newRealm oldRealm:oldRealm schema:mutableSchema] execute:migrationBlock];
+                RLMMigration *migration = [[RLMMigration alloc] initWithRealm:newRealm oldRealm:oldRealm schema:mutableSchema];
+                [migration scheduleChunkedMigrationForClasses:chunkedMigrationClasses];
+                [migration scheduleLazyMigrationForProperties:lazyMigrationProperties];
+                [migration execute:migrationBlock];
 
                 oldRealm->_realm = nullptr;
                 newRealm->_realm = nullptr;
@@ -544,13 +594,39 @@ REALM_NOINLINE void RLMRealmTranslateException(NSError **error) {
         }
     }
 
+    // The migration blocks below can run for a long time and may open other
+    // Realms, so they must not block every other Realm from being opened
+    lock.unlock();
+
+    // Complete any chunked migration (either one which was just scheduled or
+    // one which was interrupted) and register the blocks for any lazy property
+    // migrations which haven't yet been applied to every object before
+    // returning the Realm. This applies to every way of opening the Realm.
+    // Concurrent openers of the same file coordinate through the state tables,
+    // which the chunked migration re-reads in each write transaction.
+    try {
+        if (!RLMCompletePendingMigrations(realm, configuration, error)) {
+            return nil;
+        }
+    }
+    catch (...) {
+        RLMRealmTranslateException(error);
+        return nil;
+    }
+
     if (cache) {
         RLMCacheRealm(config.path, cacheKey, realm);
     }
 
-    if (!readOnly) {
+    // Read-only Realms which aren't immutable can still have their schema
+    // changed by another process, and the binding context is what keeps the
+    // column keys cached on the class info current
+    if (!readOnly || !config.immutable()) {
         realm->_realm->m_binding_context = RLMCreateBindingContext(realm);
         realm->_realm->m_binding_context->realm = realm->_realm;
+        // Any schema change between creating the class info and attaching the
+        // binding context, such as by a pending chunked migration, was missed
+        realm->_info.updateColumnKeys();
     }
 
     return RLMAutorelease(realm);
@@ -737,6 +813,10 @@ REALM_NOINLINE void RLMRealmTranslateException(NSError **error) {
     return [reference resolveReferenceInRealm:self];
 }
 
+- (NSArray *)resolveThreadSafeBatchReference:(RLMThreadSafeBatchReference *)reference {
+    return [reference resolveReferenceInRealm:self];
+}
+
 /**
  Replaces all string columns in this Realm with a string enumeration column and compacts the
  database file.
@@ -1007,6 +1087,14 @@ REALM_NOINLINE void RLMRealmTranslateException(NSError **error) {
     return self.isFrozen ? [RLMRealm realmWithConfiguration:self.configuration error:nil] : self;
 }
 
++ (NSArray *)freezeObjects:(id<NSFastEnumeration>)objects {
+    return RLMFreezeObjects(objects);
+}
+
++ (NSArray *)thawObjects:(id<NSFastEnumeration>)objects {
+    return RLMThawObjects(objects);
+}
+
 - (RLMRealm *)frozenCopy {
     try {
         RLMRealm *realm = [[RLMRealm alloc] initPrivate];
@@ -1015,6 +1103,7 @@ REALM_NOINLINE void RLMRealmTranslateException(NSError **error) {
         realm->_dynamic = _dynamic;
         realm->_schema = _schema;
         realm->_info = RLMSchemaInfo(realm);
+        RLMCopyLazyMigrations(self, realm);
         return realm;
     }
     catch (std::exception const& e) {
@@ -32,6 +32,39 @@ NS_ASSUME_NONNULL_BEGIN
  */
 typedef BOOL (^RLMShouldCompactOnLaunchBlock)(NSUInteger totalBytes, NSUInteger bytesUsed);
 
+/**
+ A block called for each object of a type during a chunked migration.
+
+ @param object              The object to migrate, as defined by the current schema.
+ @param oldSchemaVersion    The schema version of the Realm before the migration began.
+
+ @see `RLMRealmConfiguration.chunkedMigrationBlocks`
+ */
+typedef void (^RLMChunkedMigrationBlock)(RLMObject *object, uint64_t oldSchemaVersion);
+
+/**
+ A block called after each chunk of a chunked migration is committed.
+
+ @param migratedObjects The number of objects which have been migrated so far
+                        when opening the Realm this time.
+ @param totalObjects    The total number of objects which needed to be migrated
+                        when the Realm was opened.
+ */
+typedef void (^RLMMigrationProgressBlock)(NSUInteger migratedObjects, NSUInteger totalObjects);
+
+/**
+ A block which computes the value of a lazily migrated property from the other
+ properties of an object.
+
+ @param object  The object whose property value is being computed, as defined
+                by the current schema.
+
+ @return The value of the property, which may be `nil` for optional properties.
+
+ @see `RLMRealmConfiguration.lazyPropertyMigrationBlocks`
+ */
+typedef id _Nullable (^RLMLazyPropertyMigrationBlock)(RLMObject *object);
+
 /**
  An `RLMRealmConfiguration` instance describes the different options used to
  create an instance of a Realm.
@@ -114,6 +147,67 @@ typedef BOOL (^RLMShouldCompactOnLaunchBlock)(NSUInteger totalBytes, NSUInteger
  */
 @property (nonatomic) BOOL deleteRealmIfMigrationNeeded;
 
+/**
+ Blocks which migrate the objects of each type in chunks after the schema has
+ been updated, keyed by the name of the object type.
+
+ When the schema version is increased, the schema changes and `migrationBlock`
+ are applied in a single write transaction as normal, and then each object of
+ the given types is passed to the corresponding block, committing a write
+ transaction after every `migrationChunkSize` objects. The position in each
+ type is persisted in the Realm file along with each chunk, so if the process
+ is terminated partway through, the chunked migration is resumed from the last
+ committed chunk the next time the Realm is opened.
+
+ The Realm is not returned until the chunked migration has completed, and any
+ attempt to open it with a configuration which does not provide the required
+ blocks will fail with `RLMErrorSchemaMismatch` until it has. Other Realms can be
+ opened while the migration runs. If the same file is opened elsewhere during
+ the migration, that open takes part in completing it and also waits for it to
+ finish.
+
+ Only data present in the current schema can be read by these blocks, so
+ values which are being moved between properties should be kept in a property
+ which is removed in a later schema version.
+ */
+@property (nonatomic, copy, nullable) NSDictionary<NSString *, RLMChunkedMigrationBlock> *chunkedMigrationBlocks;
+
+/**
+ The number of objects to migrate in each write transaction when performing a
+ chunked migration. Defaults to 1000.
+ */
+@property (nonatomic) NSUInteger migrationChunkSize;
+
+/**
+ A block called after each chunk of a chunked migration is committed, which
+ can be used to report the progress of the migration.
+ */
+@property (nonatomic, copy, nullable) RLMMigrationProgressBlock migrationProgressBlock;
+
+/**
+ Blocks which compute the values of properties derived from other properties of
+ the same object, keyed by `"ClassName.propertyName"`.
+
+ When the schema version is increased, the given properties are marked as
+ pending rather than being filled in by the migration. Reading a pending
+ property computes its value by calling the block, and a background sweep
+ stores the computed values for all objects of the type in chunks of
+ `migrationChunkSize` objects, resuming from the last committed chunk if it is
+ interrupted. This allows adding a derived property to a large type without
+ blocking opening the Realm on a migration which touches every object.
+
+ Only the objects which exist when the migration is scheduled are migrated, and
+ the blocks must compute the value solely from the object passed to them.
+ Setting a pending property on one of those objects before the sweep has
+ reached it throws an exception, while objects created afterwards store the
+ values they are given. Querying, sorting, distinct, aggregate
+ functions and reading the property from every object of a collection with
+ `valueForKey:` throw an exception for a pending property until the sweep has
+ completed. Opening the Realm without the blocks for every pending property
+ (including opening it as a dynamic Realm) fails with `RLMErrorSchemaMismatch`.
+ */
+@property (nonatomic, copy, nullable) NSDictionary<NSString *, RLMLazyPropertyMigrationBlock> *lazyPropertyMigrationBlocks;
+
 /**
  A block called when opening a Realm for the first time during the life
  of a process to determine if it should be compacted before being returned
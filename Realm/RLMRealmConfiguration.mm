@@ -103,6 +103,7 @@ NSString *RLMRealmPathForFile(NSString *fileName) {
         self.fileURL = defaultRealmURL;
         self.schemaVersion = 0;
         self.cache = YES;
+        self.migrationChunkSize = 1000;
     }
 
     return self;
@@ -114,6 +115,10 @@ NSString *RLMRealmPathForFile(NSString *fileName) {
     configuration->_cache = _cache;
     configuration->_dynamic = _dynamic;
     configuration->_migrationBlock = _migrationBlock;
+    configuration->_chunkedMigrationBlocks = _chunkedMigrationBlocks;
+    configuration->_migrationChunkSize = _migrationChunkSize;
+    configuration->_migrationProgressBlock = _migrationProgressBlock;
+    configuration->_lazyPropertyMigrationBlocks = _lazyPropertyMigrationBlocks;
     configuration->_shouldCompactOnLaunch = _shouldCompactOnLaunch;
     configuration->_customSchema = _customSchema;
     return configuration;
@@ -237,6 +242,13 @@ static bool isSync(realm::Realm::Config const& config) {
     _config.schema_version = schemaVersion;
 }
 
+- (void)setMigrationChunkSize:(NSUInteger)migrationChunkSize {
+    if (migrationChunkSize == 0) {
+        @throw RLMException(@"Migration chunk size must be greater than zero.");
+    }
+    _migrationChunkSize = migrationChunkSize;
+}
+
 - (BOOL)deleteRealmIfMigrationNeeded {
     return _config.schema_mode == realm::SchemaMode::ResetFile;
 }
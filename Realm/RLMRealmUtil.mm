@@ -118,6 +118,14 @@ public:
         }
     }
 
+    void schema_did_change(realm::Schema const&) override {
+        // Core updates the column keys of the existing object schemas in
+        // place, so the copies the accessors read have to be refreshed
+        if (auto realm = _realm) {
+            realm->_info.updateColumnKeys();
+        }
+    }
+
     void will_change(std::vector<ObserverState> const& observed, std::vector<void*> const& invalidated) override {
         @autoreleasepool {
             RLMWillChange(observed, invalidated);
@@ -107,6 +107,34 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (nullable NSArray<RLMObjectType> *)objectsAtIndexes:(NSIndexSet *)indexes;
 
+/**
+ Returns an array of the objects currently in the results collection which
+ stores only a reference to each object rather than the object itself.
+
+ A new object is created each time an element of the array is accessed, and is
+ not retained by the array. This makes holding on to the array for a large
+ number of objects, such as to back a grid or table view, use far less memory
+ than holding on to the objects, at the cost of creating the object again on
+ each access.
+
+ Like the objects in the results, the array can only be used on the thread the
+ results were created on. The array does not update to reflect changes to the
+ Realm, and accessing an element whose object has since been deleted throws an
+ exception.
+
+ @warning Because a new object is created on each access, accessing the same
+          index twice returns two different objects, so `array[0] != array[0]`.
+          Compare elements with `isEqual:` rather than by pointer, and do not
+          use methods which compare by identity, such as
+          `indexOfObjectIdenticalTo:`, or store per-element state in
+          associated objects or weak references to the elements. Use
+          `objectsAtIndexes:` or copy the elements into a regular array if
+          stable object identity is required.
+
+ @return An array of the objects in the results.
+ */
+- (NSArray<RLMObjectType> *)compactObjectArray;
+
 /**
  Returns the first object in the results collection.
 
@@ -474,6 +502,27 @@ __attribute__((warn_unused_result));
 /// :nodoc:
 - (RLMObjectType)objectAtIndexedSubscript:(NSUInteger)index;
 
+#pragma mark - BSON
+
+/**
+ Returns the objects in the results encoded as binary BSON documents.
+
+ The documents are written one after another into a single buffer in the
+ order of the results, which is the same layout as a `.bson` file produced by
+ `mongodump`. The values are read directly from the Realm file without creating
+ any intermediate Objective-C objects, which makes this much faster than
+ converting each object to a dictionary. Embedded objects are encoded as
+ nested documents and links to other objects as the linked object's primary
+ key, or `null` if it does not have one.
+
+ @param keyPaths The names of the properties to include in each document, or
+                 `nil` to include every property other than linking objects
+                 properties.
+
+ @return A buffer containing one BSON document for each object.
+ */
+- (NSData *)bsonDocumentsForKeyPaths:(nullable NSArray<NSString *> *)keyPaths;
+
 #pragma mark - Freeze
 
 /**
@@ -20,6 +20,7 @@
 
 #import "RLMAccessor.hpp"
 #import "RLMArray_Private.hpp"
+#import "RLMBSON_Private.hpp"
 #import "RLMCollection_Private.hpp"
 #import "RLMObjectSchema_Private.hpp"
 #import "RLMObjectStore.h"
@@ -209,6 +210,7 @@ static inline void RLMResultsValidateInWriteTransaction(__unsafe_unretained RLMR
         if (_results.get_type() != realm::PropertyType::Object) {
             @throw RLMException(@"Querying is currently only implemented for arrays of Realm Objects");
         }
+        RLMVerifyNoPendingLazyMigration(*_info, predicate);
         return RLMConvertNotFound(_results.index_of(RLMPredicateToQuery(predicate, _info->rlmObjectSchema, _realm.schema, _realm.group)));
     });
 }
@@ -220,6 +222,35 @@ static inline void RLMResultsValidateInWriteTransaction(__unsafe_unretained RLMR
     });
 }
 
+- (std::vector<realm::ObjKey>)objectKeys {
+    return translateRLMResultsErrors([&] {
+        std::vector<ObjKey> keys;
+        size_t size = _results.size();
+        keys.reserve(size);
+        for (size_t i = 0; i < size; ++i) {
+            keys.push_back(_results.get(i).get_key());
+        }
+        return keys;
+    });
+}
+
+- (NSArray *)compactObjectArray {
+    if (!_info) {
+        return @[];
+    }
+    if (_results.get_type() != realm::PropertyType::Object) {
+        @throw RLMException(@"compactObjectArray is only supported for results of objects");
+    }
+    std::vector<ObjKey> objectKeys = [self objectKeys];
+    std::vector<std::pair<uint32_t, ObjKey>> keys;
+    keys.reserve(objectKeys.size());
+    for (auto key : objectKeys) {
+        keys.emplace_back(0, key);
+    }
+    return [[RLMObjectKeyArray alloc] initWithRealm:_realm infos:std::vector<RLMClassInfo *>{_info}
+                                               keys:std::move(keys) cacheObjects:false];
+}
+
 - (NSArray *)objectsAtIndexes:(NSIndexSet *)indexes {
     if (!_info) {
         return nil;
@@ -389,6 +420,7 @@ static inline void RLMResultsValidateInWriteTransaction(__unsafe_unretained RLMR
         if (_results.get_type() != realm::PropertyType::Object) {
             @throw RLMException(@"Querying is currently only implemented for arrays of Realm Objects");
         }
+        RLMVerifyNoPendingLazyMigration(*_info, predicate);
         auto query = RLMPredicateToQuery(predicate, _info->rlmObjectSchema, _realm.schema, _realm.group);
         return [self subresultsWithResults:_results.filter(std::move(query))];
     });
@@ -406,6 +438,9 @@ static inline void RLMResultsValidateInWriteTransaction(__unsafe_unretained RLMR
         if (_results.get_mode() == Results::Mode::Empty) {
             return self;
         }
+        if (_info) {
+            RLMVerifyNoPendingLazyMigration(*_info, [properties valueForKey:@"keyPath"]);
+        }
         return [self subresultsWithResults:_results.sort(RLMSortDescriptorsToKeypathArray(properties))];
     });
 }
@@ -422,6 +457,10 @@ static inline void RLMResultsValidateInWriteTransaction(__unsafe_unretained RLMR
             return self;
         }
         
+        if (_info) {
+            RLMVerifyNoPendingLazyMigration(*_info, keyPaths);
+        }
+
         std::vector<std::string> keyPathsVector;
         for (NSString *keyPath in keyPaths) {
             keyPathsVector.push_back(keyPath.UTF8String);
@@ -443,6 +482,7 @@ static inline void RLMResultsValidateInWriteTransaction(__unsafe_unretained RLMR
     ColKey column;
     if (self.type == RLMPropertyTypeObject || ![property isEqualToString:@"self"]) {
         column = _info->tableColumn(property);
+        RLMVerifyNoPendingLazyMigration(*_info, @[property]);
     }
 
     auto value = translateRLMResultsErrors([&] { return (_results.*method)(column); }, methodName);
@@ -471,6 +511,7 @@ static inline void RLMResultsValidateInWriteTransaction(__unsafe_unretained RLMR
     ColKey column;
     if (self.type == RLMPropertyTypeObject || ![property isEqualToString:@"self"]) {
         column = _info->tableColumn(property);
+        RLMVerifyNoPendingLazyMigration(*_info, @[property]);
     }
     auto value = translateRLMResultsErrors([&] { return _results.average(column); }, @"averageOfProperty");
     return value ? RLMMixedToObjc(*value) : nil;
@@ -514,6 +555,45 @@ static inline void RLMResultsValidateInWriteTransaction(__unsafe_unretained RLMR
     });
 }
 
+- (RLMResults *)materializedFrozenCopy {
+    return translateRLMResultsErrors([&] {
+        // Importing results which have been evaluated copies the keys of the
+        // matching objects rather than the query
+        _results.evaluate_query_if_needed();
+        return [self resolveInRealm:_realm.freeze];
+    });
+}
+
+- (NSData *)bsonDocumentsForKeyPaths:(NSArray<NSString *> *)keyPaths {
+    return translateRLMResultsErrors([&] {
+        if (!_info || _results.get_type() != realm::PropertyType::Object) {
+            @throw RLMException(@"BSON documents can only be created for results of objects.");
+        }
+        NSMutableArray<RLMProperty *> *properties;
+        if (keyPaths) {
+            properties = [NSMutableArray arrayWithCapacity:keyPaths.count];
+            for (NSString *keyPath in keyPaths) {
+                if ([keyPath rangeOfString:@"."].location != NSNotFound) {
+                    @throw RLMException(@"Nested key paths are not supported for BSON documents.");
+                }
+                [properties addObject:RLMValidatedProperty(_info->rlmObjectSchema, keyPath)];
+            }
+        }
+
+        std::string buffer;
+        size_t size = _results.size();
+        for (size_t i = 0; i < size; ++i) {
+            RLMAppendObjectBson(buffer, *_info, _results.get(i), properties);
+            if (i == 0) {
+                // Assume the rest of the documents are about the same size
+                // as the first to avoid repeatedly growing the buffer
+                buffer.reserve(buffer.size() * size);
+            }
+        }
+        return RLMDataWithBsonBuffer(std::move(buffer));
+    });
+}
+
 - (BOOL)isFrozen {
     return _realm.frozen;
 }
@@ -42,6 +42,18 @@ NS_ASSUME_NONNULL_BEGIN
 + (instancetype)resultsWithObjectInfo:(RLMClassInfo&)info results:(realm::Results&&)results;
 
 - (instancetype)subresultsWithResults:(realm::Results)results;
+
+// Get the keys of the objects in the results without creating accessors for
+// them. Must only be called on results of objects.
+- (std::vector<realm::ObjKey>)objectKeys;
+
+// Evaluate the query if needed and return a frozen copy of the results at the
+// current version. The copy holds the keys of the matching objects, so reading
+// it or importing it into a Realm at the same version never runs the query again.
+- (RLMResults *)materializedFrozenCopy;
+
+// Import these results into another Realm for the same file
+- (instancetype)resolveInRealm:(RLMRealm *)realm;
 @end
 
 NS_ASSUME_NONNULL_END
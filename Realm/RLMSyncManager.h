@@ -20,7 +20,7 @@
 
 #import <Realm/RLMSyncUtil.h>
 
-@class RLMSyncSession, RLMSyncTimeoutOptions, RLMAppConfiguration;
+@class RLMSyncSession, RLMSyncSessionStatistics, RLMSyncTimeoutOptions, RLMAppConfiguration, RLMRealmConfiguration;
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -58,6 +58,32 @@ typedef RLM_CLOSED_ENUM(NSUInteger, RLMSyncLogLevel) {
 /// responsible for performing its own synchronization if any is required.
 typedef void (*RLMSyncLogFunction)(RLMSyncLogLevel level, NSString *message);
 
+/// A block type used to report the aggregate progress of a prefetch. `completedRealms`
+/// is the number of Realms which have finished downloading, and the byte counts are
+/// summed over all Realms which have started downloading.
+typedef void(^RLMPrefetchProgressBlock)(NSUInteger completedRealms, NSUInteger totalRealms,
+                                        NSUInteger transferredBytes, NSUInteger transferrableBytes);
+
+/// A block type used to report the completion of a prefetch. `errors` contains
+/// the error for each Realm which could not be downloaded, keyed by its index
+/// in the array of configurations passed to the prefetch, and is empty if all
+/// of them were downloaded successfully.
+typedef void(^RLMPrefetchCompletionBlock)(NSDictionary<NSNumber *, NSError *> *errors);
+
+/**
+ A task object which can be used to observe or cancel a prefetch started with
+ `-[RLMSyncManager prefetchRealmsWithConfigurations:priorities:maxConcurrentDownloads:maxOutstandingBytes:progress:completion:]`.
+ */
+@interface RLMPrefetchTask : NSObject
+/**
+ Cancel the prefetch.
+
+ Downloads which are in progress are cancelled, no further downloads are
+ started, and the completion block is never called.
+ */
+- (void)cancel;
+@end
+
 /// A block type representing a block which can be used to report a sync-related error to the application. If the error
 /// pertains to a specific session, that session will also be passed into the block.
 typedef void(^RLMSyncErrorReportingBlock)(NSError *, RLMSyncSession * _Nullable);
@@ -119,6 +145,28 @@ typedef void(^RLMSyncErrorReportingBlock)(NSError *, RLMSyncSession * _Nullable)
  */
 @property (nonatomic, nullable) RLMSyncLogFunction logger;
 
+/**
+ Whether log messages are delivered asynchronously on a background queue rather
+ than on the thread which produced them. Defaults to `NO`.
+
+ When enabled, the sync client copies each message into a fixed-size buffer and
+ continues without waiting for `logger` to process it, so a slow logger does
+ not slow down sync. Messages are delivered in order, but if the buffer is full
+ new messages are discarded and counted in `droppedLogMessageCount`.
+
+ @warning This property must be set before any synced Realms are opened. Setting
+ it after opening any synced Realm will do nothing.
+ */
+@property (nonatomic) BOOL logsAsynchronously;
+
+/**
+ The number of log messages which have been discarded because they were
+ produced faster than they could be delivered while `logsAsynchronously` was
+ enabled. The count is not reset when `logger` or `logsAsynchronously` is
+ changed.
+ */
+@property (nonatomic, readonly) NSUInteger droppedLogMessageCount;
+
 /**
  The name of the HTTP header to send authorization data in when making requests to MongoDB Realm which has
  been configured to expect a custom authorization header.
@@ -143,6 +191,54 @@ typedef void(^RLMSyncErrorReportingBlock)(NSError *, RLMSyncSession * _Nullable)
  */
 @property (nullable, nonatomic, copy) RLMSyncTimeoutOptions *timeoutOptions;
 
+/**
+ Data transfer statistics summed over every sync session which currently
+ exists for a user of this app.
+
+ Collection starts for each session the first time statistics are requested
+ for it, so sessions which did not exist when this was last read only
+ contribute the data transferred since this read.
+
+ @see `RLMSyncSessionStatistics`
+ */
+@property (nonatomic, readonly) RLMSyncSessionStatistics *statistics;
+
+/**
+ Download a set of synchronized Realms in the background, a limited number at a
+ time.
+
+ Each Realm is downloaded in the same way as by
+ `+[RLMRealm asyncOpenWithConfiguration:callbackQueue:callback:]`, but without
+ opening an `RLMRealm` on a callback queue once the download completes. Realms
+ are downloaded in order of descending priority, with Realms with equal
+ priority being downloaded in the order they appear in `configurations`. No more than
+ `maxConcurrentDownloads` Realms are downloaded at once. If
+ `maxOutstandingBytes` is non-zero, new downloads are also held back while the
+ Realms currently being downloaded have at least that many bytes left to
+ download, or while any of them has yet to report how much it has to download.
+ At least one download is always allowed to proceed.
+
+ The Realms are not kept open once they have been downloaded.
+
+ @param configurations         The configurations of the Realms to download.
+ @param priorities             The priority of each Realm, or `nil` to open them in order.
+                               Must contain the same number of elements as `configurations`.
+ @param maxConcurrentDownloads The maximum number of Realms to download at once.
+ @param maxOutstandingBytes    The maximum number of bytes left to download before
+                               another download is started, or 0 for no limit.
+ @param progress               A block which is called on the main queue as the
+                               aggregate progress changes.
+ @param completion             A block which is called on the main queue once all
+                               of the Realms have been downloaded or have failed.
+ @return A task which can be used to cancel the prefetch.
+ */
+- (RLMPrefetchTask *)prefetchRealmsWithConfigurations:(NSArray<RLMRealmConfiguration *> *)configurations
+                                           priorities:(nullable NSArray<NSNumber *> *)priorities
+                               maxConcurrentDownloads:(NSUInteger)maxConcurrentDownloads
+                                  maxOutstandingBytes:(NSUInteger)maxOutstandingBytes
+                                             progress:(nullable RLMPrefetchProgressBlock)progress
+                                           completion:(RLMPrefetchCompletionBlock)completion;
+
 /// :nodoc:
 - (instancetype)init __attribute__((unavailable("RLMSyncManager cannot be created directly")));
 
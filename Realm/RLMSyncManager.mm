@@ -20,6 +20,7 @@
 
 #import "RLMApp_Private.hpp"
 #import "RLMRealmConfiguration+Sync.h"
+#import "RLMRealm_Private.h"
 #import "RLMSyncConfiguration_Private.hpp"
 #import "RLMSyncSession_Private.hpp"
 #import "RLMUser_Private.hpp"
@@ -30,6 +31,10 @@
 #import <realm/object-store/sync/sync_manager.hpp>
 #import <realm/object-store/sync/sync_session.hpp>
 
+#import <algorithm>
+#import <atomic>
+#import <vector>
+
 #if !defined(REALM_COCOA_VERSION)
 #import "RLMVersion.h"
 #endif
@@ -93,8 +98,313 @@ struct CallbackLogger : public realm::util::RootLogger {
     }
 };
 
+struct AsyncLogger : public realm::util::RootLogger {
+    std::shared_ptr<RLMAsyncLogBuffer> buffer;
+    void do_log(Level level, const std::string& message) override {
+        buffer->push(level, message);
+    }
+};
+
+struct PrefetchDownload {
+    uint64_t transferred = 0;
+    uint64_t transferrable = 0;
+    bool reported = false;
+    bool complete = false;
+};
+
 } // anonymous namespace
 
+#pragma mark - RLMAsyncLogBuffer
+
+RLMAsyncLogBuffer::RLMAsyncLogBuffer(RLMSyncLogFunction logFn, size_t capacity,
+                                     std::shared_ptr<std::atomic<uint64_t>> total_dropped)
+: m_log_fn(logFn)
+, m_mask(capacity - 1)
+, m_slots(new Slot[capacity])
+, m_queue(dispatch_queue_create("io.realm.sync.log", DISPATCH_QUEUE_SERIAL))
+, m_total_dropped(std::move(total_dropped))
+{
+    REALM_ASSERT((capacity & m_mask) == 0);
+    for (size_t i = 0; i < capacity; ++i) {
+        m_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+void RLMAsyncLogBuffer::push(Level level, const std::string& message) {
+    size_t pos = m_enqueue_pos.load(std::memory_order_relaxed);
+    Slot* slot;
+    while (true) {
+        slot = &m_slots[pos & m_mask];
+        size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+        if (diff == 0) {
+            if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (diff < 0) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            m_total_dropped->fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        else {
+            pos = m_enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+    slot->level = level;
+    slot->message.assign(message);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+
+    if (!m_drain_scheduled.exchange(true, std::memory_order_acq_rel)) {
+        auto self = shared_from_this();
+        dispatch_async(m_queue, ^{
+            self->drain();
+        });
+    }
+}
+
+void RLMAsyncLogBuffer::deliver(Level level, NSString *message) {
+    if (m_log_fn) {
+        m_log_fn(logLevelForLevel(level), message);
+    }
+    else {
+        NSLog(@"Sync: %@", message);
+    }
+}
+
+// Only called on m_queue. The flag is cleared before reading so that any
+// message pushed after the last slot we see schedules another drain.
+void RLMAsyncLogBuffer::drain() {
+    m_drain_scheduled.store(false, std::memory_order_release);
+    while (true) {
+        size_t count = 0;
+        @autoreleasepool {
+            for (; count < batch_size; ++count) {
+                Slot& slot = m_slots[m_dequeue_pos & m_mask];
+                if (slot.sequence.load(std::memory_order_acquire) != m_dequeue_pos + 1)
+                    break;
+                NSString *message = [[NSString alloc] initWithBytes:slot.message.data()
+                                                             length:slot.message.size()
+                                                           encoding:NSUTF8StringEncoding];
+                Level level = slot.level;
+                slot.sequence.store(m_dequeue_pos + m_mask + 1, std::memory_order_release);
+                ++m_dequeue_pos;
+                deliver(level, message ?: @"");
+            }
+        }
+        if (count < batch_size)
+            break;
+    }
+
+    if (uint64_t dropped = m_dropped.load(std::memory_order_relaxed); dropped != m_reported_dropped) {
+        @autoreleasepool {
+            deliver(Level::warn, [NSString stringWithFormat:@"%llu sync log messages were discarded because the log buffer was full",
+                                  dropped - m_reported_dropped]);
+        }
+        m_reported_dropped = dropped;
+    }
+}
+
+#pragma mark - RLMPrefetchTask
+
+@interface RLMPrefetchTask ()
+- (instancetype)initWithConfigurations:(NSArray<RLMRealmConfiguration *> *)configurations
+                            priorities:(NSArray<NSNumber *> *)priorities
+                maxConcurrentDownloads:(NSUInteger)maxConcurrentDownloads
+                   maxOutstandingBytes:(NSUInteger)maxOutstandingBytes
+                              progress:(RLMPrefetchProgressBlock)progress
+                            completion:(RLMPrefetchCompletionBlock)completion;
+- (void)start;
+@end
+
+// All state other than _cancelled is only accessed on _queue
+@implementation RLMPrefetchTask {
+    dispatch_queue_t _queue;
+    NSArray<RLMRealmConfiguration *> *_configurations;
+    NSUInteger _maxConcurrentDownloads;
+    NSUInteger _maxOutstandingBytes;
+    RLMPrefetchProgressBlock _progress;
+    RLMPrefetchCompletionBlock _completion;
+
+    std::vector<NSUInteger> _order;
+    std::vector<PrefetchDownload> _downloads;
+    size_t _nextDownload;
+    NSUInteger _completedCount;
+    NSMutableDictionary<NSNumber *, RLMAsyncOpenTask *> *_active;
+    NSMutableDictionary<NSNumber *, NSError *> *_errors;
+    // Also read on the main queue to skip progress reports after cancelling
+    std::atomic<bool> _cancelled;
+    bool _progressScheduled;
+    bool _progressChanged;
+}
+
+- (instancetype)initWithConfigurations:(NSArray<RLMRealmConfiguration *> *)configurations
+                            priorities:(NSArray<NSNumber *> *)priorities
+                maxConcurrentDownloads:(NSUInteger)maxConcurrentDownloads
+                   maxOutstandingBytes:(NSUInteger)maxOutstandingBytes
+                              progress:(RLMPrefetchProgressBlock)progress
+                            completion:(RLMPrefetchCompletionBlock)completion {
+    if (self = [super init]) {
+        _queue = dispatch_queue_create("io.realm.sync.prefetch", DISPATCH_QUEUE_SERIAL);
+        _configurations = [configurations copy];
+        _maxConcurrentDownloads = maxConcurrentDownloads;
+        _maxOutstandingBytes = maxOutstandingBytes;
+        _progress = progress;
+        _completion = completion;
+        _downloads.resize(configurations.count);
+        _active = [NSMutableDictionary new];
+        _errors = [NSMutableDictionary new];
+
+        _order.resize(configurations.count);
+        for (NSUInteger i = 0; i < configurations.count; ++i) {
+            _order[i] = i;
+        }
+        if (priorities) {
+            std::stable_sort(_order.begin(), _order.end(), [&](NSUInteger a, NSUInteger b) {
+                return priorities[a].doubleValue > priorities[b].doubleValue;
+            });
+        }
+    }
+    return self;
+}
+
+- (void)start {
+    dispatch_async(_queue, ^{
+        [self startDownloads];
+    });
+}
+
+- (void)cancel {
+    dispatch_async(_queue, ^{
+        if (_cancelled) {
+            return;
+        }
+        _cancelled = true;
+        for (RLMAsyncOpenTask *task in _active.allValues) {
+            [task cancel];
+        }
+        [_active removeAllObjects];
+    });
+}
+
+- (bool)hasDownloadBudget {
+    if (_active.count == 0) {
+        return true;
+    }
+    if (_active.count >= _maxConcurrentDownloads) {
+        return false;
+    }
+    if (_maxOutstandingBytes == 0) {
+        return true;
+    }
+    uint64_t outstanding = 0;
+    for (NSNumber *index in _active) {
+        auto& download = _downloads[index.unsignedIntegerValue];
+        if (!download.reported) {
+            return false;
+        }
+        if (download.transferrable > download.transferred) {
+            outstanding += download.transferrable - download.transferred;
+        }
+    }
+    return outstanding < _maxOutstandingBytes;
+}
+
+- (void)startDownloads {
+    while (!_cancelled && _nextDownload < _order.size() && [self hasDownloadBudget]) {
+        NSUInteger index = _order[_nextDownload++];
+        RLMAsyncOpenTask *task = [RLMRealm asyncOpenWithConfiguration:_configurations[index]
+                                                             callback:^(NSError *error) {
+            dispatch_async(_queue, ^{
+                [self finishDownload:index error:error];
+            });
+        }];
+        _active[@(index)] = task;
+        [task addProgressNotificationOnQueue:_queue minimumInterval:0 minimumDelta:0
+                                       block:^(NSUInteger transferred, NSUInteger transferrable) {
+            auto& download = _downloads[index];
+            if (download.complete) {
+                return;
+            }
+            download = {transferred, transferrable, true, false};
+            [self reportProgress];
+            [self startDownloads];
+        }];
+    }
+}
+
+- (void)finishDownload:(NSUInteger)index error:(NSError *)error {
+    if (_cancelled || !_active[@(index)]) {
+        return;
+    }
+    [_active removeObjectForKey:@(index)];
+    auto& download = _downloads[index];
+    download.complete = true;
+    download.transferred = download.transferrable;
+    ++_completedCount;
+    if (error) {
+        _errors[@(index)] = error;
+    }
+    [self reportProgress];
+
+    if (_completedCount == _downloads.size()) {
+        // The final progress is reported along with the completion so that it
+        // is neither coalesced away nor delivered after it
+        RLMPrefetchCompletionBlock completion = _completion;
+        NSDictionary *errors = [_errors copy];
+        dispatch_block_t report = _progress ? [self progressReport] : nil;
+        dispatch_async(dispatch_get_main_queue(), ^{
+            if (report) {
+                report();
+            }
+            completion(errors);
+        });
+        return;
+    }
+    [self startDownloads];
+}
+
+// Returns a block which reports the current aggregate progress
+- (dispatch_block_t)progressReport {
+    RLMPrefetchProgressBlock progress = _progress;
+    NSUInteger completed = _completedCount, total = _downloads.size();
+    NSUInteger transferred = 0, transferrable = 0;
+    for (auto& download : _downloads) {
+        transferred += static_cast<NSUInteger>(download.transferred);
+        transferrable += static_cast<NSUInteger>(download.transferrable);
+    }
+    return ^{
+        progress(completed, total, transferred, transferrable);
+    };
+}
+
+// Coalesces progress updates so that at most one is waiting on the main queue.
+// Changes made while one is waiting are reported once it has been delivered.
+- (void)reportProgress {
+    if (!_progress || _completedCount == _downloads.size()) {
+        return;
+    }
+    if (_progressScheduled) {
+        _progressChanged = true;
+        return;
+    }
+    _progressScheduled = true;
+    dispatch_block_t report = [self progressReport];
+    dispatch_async(dispatch_get_main_queue(), ^{
+        if (!_cancelled) {
+            report();
+        }
+        dispatch_async(_queue, ^{
+            _progressScheduled = false;
+            if (_progressChanged) {
+                _progressChanged = false;
+                [self reportProgress];
+            }
+        });
+    });
+}
+
+@end
+
 #pragma mark - RLMSyncManager
 
 @interface RLMSyncTimeoutOptions () {
@@ -105,12 +415,16 @@ struct CallbackLogger : public realm::util::RootLogger {
 
 @implementation RLMSyncManager {
     std::shared_ptr<SyncManager> _syncManager;
+    // Shared by every log buffer so that the count is not reset when the
+    // logger is replaced
+    std::shared_ptr<std::atomic<uint64_t>> _droppedLogMessageCount;
 }
 
 - (instancetype)initWithSyncManager:(std::shared_ptr<realm::SyncManager>)syncManager {
     if (self = [super init]) {
         [RLMUser _setUpBindingContextFactory];
         _syncManager = syncManager;
+        _droppedLogMessageCount = std::make_shared<std::atomic<uint64_t>>(0);
         return self;
     }
     return nil;
@@ -169,7 +483,32 @@ struct CallbackLogger : public realm::util::RootLogger {
 
 - (void)setLogger:(RLMSyncLogFunction)logFn {
     _logger = logFn;
-    if (_logger) {
+    [self updateLoggerFactory];
+}
+
+- (void)setLogsAsynchronously:(BOOL)logsAsynchronously {
+    _logsAsynchronously = logsAsynchronously;
+    [self updateLoggerFactory];
+}
+
+- (NSUInteger)droppedLogMessageCount {
+    return static_cast<NSUInteger>(_droppedLogMessageCount->load(std::memory_order_relaxed));
+}
+
+- (void)updateLoggerFactory {
+    RLMSyncLogFunction logFn = _logger;
+    if (_logsAsynchronously) {
+        // Messages logged before the factory is replaced may still be in the
+        // old buffer, which is kept alive by its pending drain
+        auto buffer = std::make_shared<RLMAsyncLogBuffer>(logFn, 4096, _droppedLogMessageCount);
+        _syncManager->set_logger_factory([buffer](realm::util::Logger::Level level) {
+            auto logger = std::make_unique<AsyncLogger>();
+            logger->buffer = buffer;
+            logger->set_level_threshold(level);
+            return logger;
+        });
+    }
+    else if (logFn) {
         _syncManager->set_logger_factory([logFn](realm::util::Logger::Level level) {
             auto logger = std::make_unique<CallbackLogger>();
             logger->logFn = logFn;
@@ -182,6 +521,46 @@ struct CallbackLogger : public realm::util::RootLogger {
     }
 }
 
+- (RLMPrefetchTask *)prefetchRealmsWithConfigurations:(NSArray<RLMRealmConfiguration *> *)configurations
+                                           priorities:(NSArray<NSNumber *> *)priorities
+                               maxConcurrentDownloads:(NSUInteger)maxConcurrentDownloads
+                                  maxOutstandingBytes:(NSUInteger)maxOutstandingBytes
+                                             progress:(RLMPrefetchProgressBlock)progress
+                                           completion:(RLMPrefetchCompletionBlock)completion {
+    if (priorities && priorities.count != configurations.count) {
+        @throw RLMException(@"The number of priorities (%@) must match the number of configurations (%@).",
+                            @(priorities.count), @(configurations.count));
+    }
+    if (maxConcurrentDownloads == 0) {
+        @throw RLMException(@"maxConcurrentDownloads must be greater than zero.");
+    }
+
+    auto task = [[RLMPrefetchTask alloc] initWithConfigurations:configurations
+                                                     priorities:priorities
+                                         maxConcurrentDownloads:maxConcurrentDownloads
+                                            maxOutstandingBytes:maxOutstandingBytes
+                                                       progress:progress
+                                                     completion:completion];
+    if (configurations.count == 0) {
+        dispatch_async(dispatch_get_main_queue(), ^{
+            completion(@{});
+        });
+        return task;
+    }
+    [task start];
+    return task;
+}
+
+- (RLMSyncSessionStatistics *)statistics {
+    std::vector<std::shared_ptr<SyncSession>> sessions;
+    for (auto& user : _syncManager->all_users()) {
+        for (auto& session : user->all_sessions()) {
+            sessions.push_back(std::move(session));
+        }
+    }
+    return RLMSyncStatisticsForSessions(sessions);
+}
+
 - (void)setTimeoutOptions:(RLMSyncTimeoutOptions *)timeoutOptions {
     _timeoutOptions = timeoutOptions;
     _syncManager->set_timeouts(timeoutOptions->_options);
@@ -212,6 +591,8 @@ struct CallbackLogger : public realm::util::RootLogger {
     _appID = nil;
     _userAgent = nil;
     _logger = nil;
+    _logsAsynchronously = NO;
+    _droppedLogMessageCount->store(0);
     _authorizationHeaderName = nil;
     _customRequestHeaders = nil;
     _timeoutOptions = nil;
@@ -20,7 +20,12 @@
 
 #import "RLMSyncUtil_Private.h"
 #import "RLMNetworkTransport.h"
+
+#import <realm/util/logger.hpp>
+
+#import <atomic>
 #import <memory>
+#import <string>
 
 namespace realm {
 struct SyncClientConfig;
@@ -32,6 +37,45 @@ class App;
 
 @class RLMAppConfiguration, RLMUser, RLMSyncConfiguration;
 
+// A bounded lock-free queue of log messages which is filled by any number of
+// loggers and drained in batches on a serial background queue. Each slot keeps
+// its string's capacity after being consumed, so once the buffer has warmed up
+// logging a message does not allocate on the producing thread.
+class RLMAsyncLogBuffer : public std::enable_shared_from_this<RLMAsyncLogBuffer> {
+public:
+    using Level = realm::util::Logger::Level;
+
+    // `capacity` must be a power of two. Discarded messages are added to
+    // `total_dropped`, which may be shared by several buffers.
+    RLMAsyncLogBuffer(RLMSyncLogFunction _Nullable logFn, size_t capacity,
+                      std::shared_ptr<std::atomic<uint64_t>> total_dropped);
+
+    void push(Level level, const std::string& message);
+
+private:
+    struct Slot {
+        std::atomic<size_t> sequence;
+        Level level;
+        std::string message;
+    };
+
+    static constexpr size_t batch_size = 64;
+
+    RLMSyncLogFunction _Nullable m_log_fn;
+    const size_t m_mask;
+    std::unique_ptr<Slot[]> m_slots;
+    dispatch_queue_t _Nonnull m_queue;
+    std::atomic<size_t> m_enqueue_pos{0};
+    size_t m_dequeue_pos = 0;
+    std::atomic<bool> m_drain_scheduled{false};
+    std::shared_ptr<std::atomic<uint64_t>> m_total_dropped;
+    std::atomic<uint64_t> m_dropped{0};
+    uint64_t m_reported_dropped = 0;
+
+    void deliver(Level level, NSString *_Nonnull message);
+    void drain();
+};
+
 // All private API methods are threadsafe and synchronized, unless denoted otherwise. Since they are expected to be
 // called very infrequently, this should pose no issues.
 
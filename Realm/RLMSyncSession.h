@@ -112,6 +112,37 @@ NS_ASSUME_NONNULL_BEGIN
 @interface RLMProgressNotificationToken : RLMNotificationToken
 @end
 
+/**
+ A snapshot of the data transferred by one or more sync sessions.
+
+ Statistics are only collected for a session once they have been requested for
+ it, either through `RLMSyncSession.statistics` or `RLMSyncManager.statistics`,
+ and are then collected until the session is destroyed. The first snapshot for
+ a session therefore reports no transferred data, and data transferred before
+ then is not counted.
+ */
+@interface RLMSyncSessionStatistics : NSObject
+/// The number of bytes uploaded to the server.
+@property (nonatomic, readonly) NSUInteger bytesUploaded;
+/// The number of bytes downloaded from the server.
+@property (nonatomic, readonly) NSUInteger bytesDownloaded;
+/// The number of times the sync client reported that more data had been uploaded.
+@property (nonatomic, readonly) NSUInteger uploadBatchCount;
+/// The number of times the sync client reported that more data had been
+/// downloaded and integrated into the local Realm.
+@property (nonatomic, readonly) NSUInteger downloadBatchCount;
+/// The number of bytes of local changes which are waiting to be uploaded.
+@property (nonatomic, readonly) NSUInteger pendingUploadBytes;
+/// The number of bytes which the server has reported are waiting to be downloaded.
+@property (nonatomic, readonly) NSUInteger pendingDownloadBytes;
+/// The number of times the session has reconnected after losing its connection.
+@property (nonatomic, readonly) NSUInteger reconnectCount;
+/// The number of seconds the session has spent disconnected or connecting.
+@property (nonatomic, readonly) NSTimeInterval timeDisconnected;
+/// The number of seconds over which these statistics were collected.
+@property (nonatomic, readonly) NSTimeInterval duration;
+@end
+
 /**
  An object encapsulating a MongoDB Realm "session". Sessions represent the
  communication between the client (and a local Realm file on disk), and the server
@@ -135,6 +166,11 @@ NS_ASSUME_NONNULL_BEGIN
 /// thread.
 @property (atomic, readonly) RLMSyncConnectionState connectionState;
 
+/// Data transfer statistics for this session, or `nil` if the session is no longer valid.
+///
+/// Statistics are collected from the first time this is read for the session.
+@property (nonatomic, readonly, nullable) RLMSyncSessionStatistics *statistics;
+
 /// The user that owns this session.
 - (nullable RLMUser *)parentUser;
 
@@ -195,6 +231,33 @@ NS_ASSUME_NONNULL_BEGIN
                                                                          block:(RLMProgressNotificationBlock)block
 NS_REFINED_FOR_SWIFT;
 
+/**
+ Register a progress notification block which is invoked at most once per
+ `minimumInterval` seconds.
+
+ This behaves like `addProgressNotificationForDirection:mode:block:`, except
+ that progress updates which arrive while the block is waiting to be called or
+ is still running are coalesced, and only the most recent one is delivered.
+ Updates are also held back until at least `minimumInterval` seconds have
+ passed and at least `minimumDelta` more bytes have been transferred since the
+ previous call to the block. An update which reports that all transferrable
+ bytes have been transferred is always delivered.
+
+ @param direction       The transfer direction (upload or download) to track in this progress notification block.
+ @param mode            The desired behavior of this progress notification block.
+ @param minimumInterval The minimum number of seconds between calls to the block.
+ @param minimumDelta    The minimum number of transferred bytes between calls to the block.
+ @param block           The block to invoke when notifications are available.
+
+ @return A token which must be held for as long as you want notifications to be delivered.
+ */
+- (nullable RLMProgressNotificationToken *)addProgressNotificationForDirection:(RLMSyncProgressDirection)direction
+                                                                          mode:(RLMSyncProgressMode)mode
+                                                               minimumInterval:(NSTimeInterval)minimumInterval
+                                                                  minimumDelta:(NSUInteger)minimumDelta
+                                                                         block:(RLMProgressNotificationBlock)block
+NS_REFINED_FOR_SWIFT;
+
 /**
  Given an error action token, immediately handle the corresponding action.
  
@@ -262,6 +325,22 @@ NS_REFINED_FOR_SWIFT;
 - (void)addProgressNotificationOnQueue:(dispatch_queue_t)queue
                                  block:(RLMProgressNotificationBlock)block;
 
+/**
+ Register a progress notification block which is called on the given queue at
+ most once per `minimumInterval` seconds.
+
+ Progress updates which arrive while the block is waiting to be called or is
+ still running are coalesced, and only the most recent one is delivered.
+ Updates are also held back until at least `minimumInterval` seconds have
+ passed and at least `minimumDelta` more bytes have been downloaded since the
+ previous call to the block. An update which reports that the download has
+ completed is always delivered.
+ */
+- (void)addProgressNotificationOnQueue:(dispatch_queue_t)queue
+                       minimumInterval:(NSTimeInterval)minimumInterval
+                          minimumDelta:(NSUInteger)minimumDelta
+                                 block:(RLMProgressNotificationBlock)block;
+
 /**
  Cancel the asynchronous open.
 
@@ -29,8 +29,285 @@
 #import <realm/object-store/sync/async_open_task.hpp>
 #import <realm/object-store/sync/sync_session.hpp>
 
+#import <chrono>
+#import <mutex>
+#import <unordered_map>
+
 using namespace realm;
 
+namespace {
+// Delivers progress notifications to a block on a queue, coalescing updates
+// which arrive while a delivery is pending so that at most one block is queued
+// at a time, and holding back updates until both the minimum interval and
+// minimum delta have passed since the last delivery.
+class ProgressThrottle : public std::enable_shared_from_this<ProgressThrottle> {
+public:
+    ProgressThrottle(dispatch_queue_t queue, RLMProgressNotificationBlock block,
+                     NSTimeInterval minimumInterval, NSUInteger minimumDelta)
+    : m_queue(queue)
+    , m_block(block)
+    , m_interval(std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(minimumInterval)))
+    , m_delta(minimumDelta)
+    {
+    }
+
+    void notify(uint64_t transferred, uint64_t transferrable) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_latest = {transferred, transferrable};
+        m_has_latest = true;
+        if (!m_scheduled) {
+            schedule();
+        }
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+    struct Progress {
+        uint64_t transferred = 0;
+        uint64_t transferrable = 0;
+    };
+
+    dispatch_queue_t m_queue;
+    RLMProgressNotificationBlock m_block;
+    const Clock::duration m_interval;
+    const uint64_t m_delta;
+
+    std::mutex m_mutex;
+    Progress m_latest;
+    Progress m_last_delivered;
+    Clock::time_point m_last_delivery;
+    bool m_has_latest = false;
+    bool m_has_delivered = false;
+    bool m_scheduled = false;
+
+    // Must be called with m_mutex held and no delivery scheduled
+    void schedule() {
+        if (!m_has_latest) {
+            return;
+        }
+        bool complete = m_latest.transferred >= m_latest.transferrable;
+        auto delay = Clock::duration::zero();
+        if (m_has_delivered && !complete) {
+            uint64_t delta = m_latest.transferred > m_last_delivered.transferred
+                           ? m_latest.transferred - m_last_delivered.transferred
+                           : m_last_delivered.transferred - m_latest.transferred;
+            if (delta < m_delta && m_latest.transferrable == m_last_delivered.transferrable) {
+                // Wait for a later update to carry us past the minimum delta
+                return;
+            }
+            delay = m_last_delivery + m_interval - Clock::now();
+        }
+
+        m_scheduled = true;
+        auto self = shared_from_this();
+        auto deliver = ^{
+            self->deliver();
+        };
+        if (delay > Clock::duration::zero()) {
+            auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(delay).count();
+            dispatch_after(dispatch_time(DISPATCH_TIME_NOW, nanoseconds), m_queue, deliver);
+        }
+        else {
+            dispatch_async(m_queue, deliver);
+        }
+    }
+
+    void deliver() {
+        Progress progress;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            progress = m_latest;
+            m_has_latest = false;
+        }
+        @autoreleasepool {
+            m_block((NSUInteger)progress.transferred, (NSUInteger)progress.transferrable);
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_last_delivered = progress;
+        m_last_delivery = Clock::now();
+        m_has_delivered = true;
+        m_scheduled = false;
+        schedule();
+    }
+};
+
+// Transfer statistics for a single SyncSession, updated from progress and
+// connection state notifications registered when collection starts
+struct SessionStatistics {
+    using Clock = std::chrono::steady_clock;
+
+    struct Direction {
+        bool has_initial = false;
+        uint64_t initial = 0;
+        uint64_t transferred = 0;
+        uint64_t transferrable = 0;
+        uint64_t accumulated = 0;
+        uint64_t batches = 0;
+
+        void update(uint64_t new_transferred, uint64_t new_transferrable) {
+            if (!has_initial) {
+                has_initial = true;
+                initial = new_transferred;
+            }
+            else if (new_transferred > transferred) {
+                ++batches;
+            }
+            else if (new_transferred < transferred) {
+                // The counters were reset, e.g. by a client reset
+                accumulated += transferred - initial;
+                initial = new_transferred;
+            }
+            transferred = new_transferred;
+            transferrable = new_transferrable;
+        }
+
+        uint64_t bytes() const {
+            return accumulated + transferred - initial;
+        }
+
+        uint64_t pending() const {
+            return transferrable > transferred ? transferrable - transferred : 0;
+        }
+    };
+
+    std::mutex mutex;
+    std::weak_ptr<SyncSession> session;
+    Direction upload;
+    Direction download;
+    const Clock::time_point started = Clock::now();
+    Clock::time_point disconnected_since = started;
+    Clock::duration time_disconnected = Clock::duration::zero();
+    uint64_t reconnects = 0;
+    bool connected = false;
+    bool has_connected = false;
+
+    // Must be called with mutex held
+    void set_connection_state(SyncSession::ConnectionState state) {
+        bool now_connected = state == SyncSession::ConnectionState::Connected;
+        if (now_connected == connected) {
+            return;
+        }
+        auto now = Clock::now();
+        if (now_connected) {
+            time_disconnected += now - disconnected_since;
+            if (has_connected) {
+                ++reconnects;
+            }
+            has_connected = true;
+        }
+        else {
+            disconnected_since = now;
+        }
+        connected = now_connected;
+    }
+};
+
+static std::mutex s_statisticsMutex;
+static auto& s_statistics = *new std::unordered_map<std::string, std::shared_ptr<SessionStatistics>>();
+
+std::shared_ptr<SessionStatistics> statisticsForSession(std::shared_ptr<SyncSession> const& session) {
+    std::lock_guard<std::mutex> lock(s_statisticsMutex);
+    for (auto it = s_statistics.begin(); it != s_statistics.end();) {
+        it = it->second->session.expired() ? s_statistics.erase(it) : std::next(it);
+    }
+    auto& statistics = s_statistics[session->path()];
+    if (statistics && statistics->session.lock() == session) {
+        return statistics;
+    }
+
+    statistics = std::make_shared<SessionStatistics>();
+    statistics->session = session;
+    {
+        std::lock_guard<std::mutex> statisticsLock(statistics->mutex);
+        statistics->set_connection_state(session->connection_state());
+    }
+
+    // The session owns these callbacks, so they must not keep the statistics alive
+    std::weak_ptr<SessionStatistics> weakStatistics = statistics;
+    session->register_connection_change_callback([=](auto, auto newState) {
+        if (auto statistics = weakStatistics.lock()) {
+            std::lock_guard<std::mutex> lock(statistics->mutex);
+            statistics->set_connection_state(newState);
+        }
+    });
+    for (auto direction : {SyncSession::ProgressDirection::upload, SyncSession::ProgressDirection::download}) {
+        session->register_progress_notifier([=](uint64_t transferred, uint64_t transferrable) {
+            if (auto statistics = weakStatistics.lock()) {
+                std::lock_guard<std::mutex> lock(statistics->mutex);
+                auto& stats = direction == SyncSession::ProgressDirection::upload ? statistics->upload
+                                                                                  : statistics->download;
+                stats.update(transferred, transferrable);
+            }
+        }, direction, true);
+    }
+    return statistics;
+}
+} // anonymous namespace
+
+@interface RLMSyncSessionStatistics ()
+@property (nonatomic, readwrite) NSUInteger bytesUploaded;
+@property (nonatomic, readwrite) NSUInteger bytesDownloaded;
+@property (nonatomic, readwrite) NSUInteger uploadBatchCount;
+@property (nonatomic, readwrite) NSUInteger downloadBatchCount;
+@property (nonatomic, readwrite) NSUInteger pendingUploadBytes;
+@property (nonatomic, readwrite) NSUInteger pendingDownloadBytes;
+@property (nonatomic, readwrite) NSUInteger reconnectCount;
+@property (nonatomic, readwrite) NSTimeInterval timeDisconnected;
+@property (nonatomic, readwrite) NSTimeInterval duration;
+@end
+
+@implementation RLMSyncSessionStatistics
+
+- (void)addStatistics:(SessionStatistics&)statistics {
+    using Seconds = std::chrono::duration<double>;
+    std::lock_guard<std::mutex> lock(statistics.mutex);
+    auto now = SessionStatistics::Clock::now();
+    auto timeDisconnected = statistics.time_disconnected;
+    if (!statistics.connected) {
+        timeDisconnected += now - statistics.disconnected_since;
+    }
+
+    _bytesUploaded += static_cast<NSUInteger>(statistics.upload.bytes());
+    _bytesDownloaded += static_cast<NSUInteger>(statistics.download.bytes());
+    _uploadBatchCount += static_cast<NSUInteger>(statistics.upload.batches);
+    _downloadBatchCount += static_cast<NSUInteger>(statistics.download.batches);
+    _pendingUploadBytes += static_cast<NSUInteger>(statistics.upload.pending());
+    _pendingDownloadBytes += static_cast<NSUInteger>(statistics.download.pending());
+    _reconnectCount += static_cast<NSUInteger>(statistics.reconnects);
+    _timeDisconnected += std::chrono::duration_cast<Seconds>(timeDisconnected).count();
+    _duration = std::max(_duration, std::chrono::duration_cast<Seconds>(now - statistics.started).count());
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:
+            @"<RLMSyncSessionStatistics: %p> {\n"
+            "\tbytesUploaded = %llu;\n"
+            "\tbytesDownloaded = %llu;\n"
+            "\tuploadBatchCount = %llu;\n"
+            "\tdownloadBatchCount = %llu;\n"
+            "\tpendingUploadBytes = %llu;\n"
+            "\tpendingDownloadBytes = %llu;\n"
+            "\treconnectCount = %llu;\n"
+            "\ttimeDisconnected = %f;\n"
+            "\tduration = %f;\n"
+            "}",
+            (__bridge void *)self,
+            (unsigned long long)_bytesUploaded, (unsigned long long)_bytesDownloaded,
+            (unsigned long long)_uploadBatchCount, (unsigned long long)_downloadBatchCount,
+            (unsigned long long)_pendingUploadBytes, (unsigned long long)_pendingDownloadBytes,
+            (unsigned long long)_reconnectCount, _timeDisconnected, _duration];
+}
+
+@end
+
+RLMSyncSessionStatistics *RLMSyncStatisticsForSessions(std::vector<std::shared_ptr<SyncSession>> const& sessions) {
+    RLMSyncSessionStatistics *statistics = [RLMSyncSessionStatistics new];
+    for (auto& session : sessions) {
+        [statistics addStatistics:*statisticsForSession(session)];
+    }
+    return statistics;
+}
+
 @interface RLMSyncErrorActionToken () {
 @public
     std::string _originalPath;
@@ -123,6 +400,18 @@ static RLMSyncConnectionState convertConnectionState(SyncSession::ConnectionStat
     return nil;
 }
 
+- (RLMSyncSessionStatistics *)statistics {
+    auto session = _session.lock();
+    if (!session) {
+        return nil;
+    }
+    // Collection starts the first time statistics are requested for the
+    // session, so that sessions which are never asked don't pay for it
+    RLMSyncSessionStatistics *statistics = [RLMSyncSessionStatistics new];
+    [statistics addStatistics:*statisticsForSession(session)];
+    return statistics;
+}
+
 - (RLMSyncConfiguration *)configuration {
     if (auto session = _session.lock()) {
         return [[RLMSyncConfiguration alloc] initWithRawConfig:session->config()];
@@ -218,6 +507,26 @@ static RLMSyncConnectionState convertConnectionState(SyncSession::ConnectionStat
     return nil;
 }
 
+- (RLMProgressNotificationToken *)addProgressNotificationForDirection:(RLMSyncProgressDirection)direction
+                                                                 mode:(RLMSyncProgressMode)mode
+                                                      minimumInterval:(NSTimeInterval)minimumInterval
+                                                         minimumDelta:(NSUInteger)minimumDelta
+                                                                block:(RLMProgressNotificationBlock)block {
+    if (auto session = _session.lock()) {
+        auto throttle = std::make_shared<ProgressThrottle>(RLMSyncSession.notificationsQueue, block,
+                                                           minimumInterval, minimumDelta);
+        auto notifier_direction = (direction == RLMSyncProgressDirectionUpload
+                                   ? SyncSession::ProgressDirection::upload
+                                   : SyncSession::ProgressDirection::download);
+        bool is_streaming = (mode == RLMSyncProgressModeReportIndefinitely);
+        uint64_t token = session->register_progress_notifier([=](uint64_t transferred, uint64_t transferrable) {
+            throttle->notify(transferred, transferrable);
+        }, notifier_direction, is_streaming);
+        return [[RLMProgressNotificationToken alloc] initWithTokenValue:token session:std::move(session)];
+    }
+    return nil;
+}
+
 + (void)immediatelyHandleError:(RLMSyncErrorActionToken *)token syncManager:(RLMSyncManager *)syncManager {
     if (!token->_isValid) {
         return;
@@ -276,14 +585,26 @@ static RLMSyncConnectionState convertConnectionState(SyncSession::ConnectionStat
 }
 
 - (void)addProgressNotificationOnQueue:(dispatch_queue_t)queue block:(RLMProgressNotificationBlock)block {
-    auto wrappedBlock = ^(NSUInteger transferred_bytes, NSUInteger transferrable_bytes) {
+    [self addWrappedProgressNotificationBlock:^(NSUInteger transferred_bytes, NSUInteger transferrable_bytes) {
         dispatch_async(queue, ^{
             @autoreleasepool {
                 block(transferred_bytes, transferrable_bytes);
             }
         });
-    };
+    }];
+}
+
+- (void)addProgressNotificationOnQueue:(dispatch_queue_t)queue
+                       minimumInterval:(NSTimeInterval)minimumInterval
+                          minimumDelta:(NSUInteger)minimumDelta
+                                 block:(RLMProgressNotificationBlock)block {
+    auto throttle = std::make_shared<ProgressThrottle>(queue, block, minimumInterval, minimumDelta);
+    [self addWrappedProgressNotificationBlock:^(NSUInteger transferred_bytes, NSUInteger transferrable_bytes) {
+        throttle->notify(transferred_bytes, transferrable_bytes);
+    }];
+}
 
+- (void)addWrappedProgressNotificationBlock:(RLMProgressNotificationBlock)wrappedBlock {
     @synchronized (self) {
         if (_task) {
             _task->register_download_progress_notifier(wrappedBlock);
@@ -20,6 +20,7 @@
 
 #import "RLMSyncUtil_Private.h"
 #import <memory>
+#import <vector>
 
 namespace realm {
 class AsyncOpenTask;
@@ -53,4 +54,8 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nonatomic) std::shared_ptr<realm::AsyncOpenTask> task;
 @end
 
+/// Sum the statistics collected for each of the given sessions, starting
+/// collection for any which are not yet being tracked.
+RLMSyncSessionStatistics *RLMSyncStatisticsForSessions(std::vector<std::shared_ptr<realm::SyncSession>> const& sessions);
+
 NS_ASSUME_NONNULL_END
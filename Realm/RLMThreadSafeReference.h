@@ -18,7 +18,7 @@
 
 #import <Foundation/Foundation.h>
 
-@class RLMRealm;
+@class RLMRealm, RLMResults;
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -79,6 +79,34 @@ NS_ASSUME_NONNULL_BEGIN
  */
 + (instancetype)referenceWithThreadConfined:(Confined)threadConfined;
 
+/**
+ Create a thread-safe reference to the objects currently in the given results.
+
+ Unlike `+referenceWithThreadConfined:`, which runs the query again in the target
+ Realm when the resolved results are first accessed, this evaluates the query in
+ the source Realm if it has not already been evaluated and hands over the keys of
+ the matching objects.
+
+ If `live` is `NO`, resolving the reference returns frozen results containing
+ exactly the objects which matched at the source version, and the query is never
+ run again.
+
+ If `live` is `YES`, resolving the reference returns live results in the target
+ Realm. If the target Realm is at the source version after resolving, the results
+ contain the objects which matched in the source Realm without running the query
+ again, and are updated as normal afterwards. Otherwise the query is run again in
+ the target Realm.
+
+ @param results The results to create a thread-safe reference to.
+ @param live    Whether the resolved results should be live results in the target
+                Realm rather than a frozen snapshot.
+
+ @note The source version of the Realm is pinned until the reference is resolved
+       or deallocated, and if `live` is `NO` until the resolved results are
+       deallocated.
+ */
++ (instancetype)referenceWithMaterializedResults:(RLMResults *)results live:(BOOL)live;
+
 /**
  Indicates if the reference can no longer be resolved because an attempt to resolve it has already
  occurred. References can only be resolved once.
@@ -103,4 +131,63 @@ NS_ASSUME_NONNULL_BEGIN
 
 @end
 
+/**
+ An object intended to be passed between threads containing thread-safe
+ references to a batch of objects managed by the same Realm.
+
+ Creating a batch reference records the type and key of each object and pins the
+ version of the source Realm once, rather than once per object as creating an
+ `RLMThreadSafeReference` for each object would. Resolving it on a Realm on
+ another thread returns an array which creates the object for each element only
+ when it is accessed.
+
+ @warning A `RLMThreadSafeBatchReference` object must be resolved at most once.
+          Failing to resolve a `RLMThreadSafeBatchReference` will result in the
+          source version of the Realm being pinned until the reference is
+          deallocated.
+
+ @see `-[RLMRealm resolveThreadSafeBatchReference:]`
+ */
+@interface RLMThreadSafeBatchReference : NSObject
+
+/**
+ Create a thread-safe reference to each of the given objects.
+
+ @param objects The objects to create references to, which must all be managed
+                by the same Realm. This can be an `NSArray` of objects or any
+                Realm collection of objects. The objects in an `RLMResults` are
+                read without creating an accessor for each object.
+
+ @note You may continue to use and access the objects after passing them to this
+       constructor.
+ */
++ (instancetype)referenceWithObjects:(id<NSFastEnumeration>)objects;
+
+/// The number of objects referenced by the batch.
+@property (nonatomic, readonly) NSUInteger count;
+
+/**
+ Indicates if the reference can no longer be resolved because an attempt to
+ resolve it has already occurred. References can only be resolved once.
+ */
+@property (nonatomic, readonly, getter = isInvalidated) BOOL invalidated;
+
+#pragma mark - Unavailable Methods
+
+/**
+ `-[RLMThreadSafeBatchReference init]` is not available because
+ `RLMThreadSafeBatchReference` cannot be created directly. Use
+ `+[RLMThreadSafeBatchReference referenceWithObjects:]` instead.
+ */
+- (instancetype)init __attribute__((unavailable("RLMThreadSafeBatchReference cannot be created directly")));
+
+/**
+ `+[RLMThreadSafeBatchReference new]` is not available because
+ `RLMThreadSafeBatchReference` cannot be created directly. Use
+ `+[RLMThreadSafeBatchReference referenceWithObjects:]` instead.
+ */
++ (instancetype)new __attribute__((unavailable("RLMThreadSafeBatchReference cannot be created directly")));
+
+@end
+
 NS_ASSUME_NONNULL_END
@@ -17,12 +17,27 @@
 ////////////////////////////////////////////////////////////////////////////
 
 #import "RLMThreadSafeReference_Private.hpp"
+
+#import "RLMCollection_Private.hpp"
+#import "RLMObjectStore.h"
+#import "RLMObject_Private.hpp"
+#import "RLMObjectSchema.h"
+#import "RLMProperty_Private.h"
+#import "RLMRealm_Private.hpp"
+#import "RLMResults_Private.hpp"
 #import "RLMUtil.hpp"
 
+#import <realm/object-store/results.hpp>
+#import <realm/object-store/shared_realm.hpp>
+
 @implementation RLMThreadSafeReference {
     realm::ThreadSafeReference _reference;
     id _metadata;
     Class _type;
+
+    // Set only for references created with +referenceWithMaterializedResults:live:
+    RLMResults *_materializedResults;
+    realm::VersionID _materializedVersion;
 }
 
 - (instancetype)initWithThreadConfined:(id<RLMThreadConfined>)threadConfined {
@@ -53,17 +68,217 @@
     return [[self alloc] initWithThreadConfined:threadConfined];
 }
 
+- (instancetype)initWithMaterializedResults:(RLMResults *)results live:(BOOL)live {
+    if (![results isKindOfClass:[RLMResults class]]) {
+        @throw RLMException(@"Cannot construct a materialized results reference to '%@', which is not an RLMResults.",
+                            results);
+    }
+    if (results.invalidated) {
+        @throw RLMException(@"Cannot construct reference to invalidated object");
+    }
+    if (!results.realm) {
+        @throw RLMException(@"Cannot construct reference to unmanaged object, "
+                            "which can be passed across threads directly");
+    }
+    if (results.type != RLMPropertyTypeObject) {
+        @throw RLMException(@"Cannot construct a materialized results reference to results of type '%@'.",
+                            RLMTypeToString(results.type));
+    }
+
+    // The query reference is only needed for live results, to advance the
+    // target Realm to the source version and to run the query again if the
+    // target Realm was already at a newer version
+    if (!(self = live ? [self initWithThreadConfined:results] : [super init])) {
+        return nil;
+    }
+    _type = [RLMResults class];
+    _materializedResults = [results materializedFrozenCopy];
+    _materializedVersion = _materializedResults.realm->_realm->read_transaction_version();
+    return self;
+}
+
++ (instancetype)referenceWithMaterializedResults:(RLMResults *)results live:(BOOL)live {
+    return [[self alloc] initWithMaterializedResults:results live:live];
+}
+
 - (id<RLMThreadConfined>)resolveReferenceInRealm:(RLMRealm *)realm {
-    if (!_reference) {
+    if (self.invalidated) {
         @throw RLMException(@"Can only resolve a thread safe reference once.");
     }
+    if (_materializedResults) {
+        return [self resolveMaterializedResultsInRealm:realm];
+    }
     return RLMTranslateError([&] {
         return [_type objectWithThreadSafeReference:std::move(_reference) metadata:_metadata realm:realm];
     });
 }
 
+- (RLMResults *)resolveMaterializedResultsInRealm:(RLMRealm *)realm {
+    RLMResults *results = _materializedResults;
+    _materializedResults = nil;
+    if (realm->_realm->config().path != results.realm->_realm->config().path) {
+        @throw RLMException(@"Cannot resolve a thread safe reference in a different Realm file.");
+    }
+    if (!_reference) {
+        // Frozen results can be read on any thread as-is
+        return results;
+    }
+
+    return RLMTranslateError([&] {
+        // Resolving the query reference advances the target Realm to at least
+        // the source version. If it was already newer the objects which matched
+        // at the source version may no longer match, so the query has to be run
+        // again.
+        realm::ThreadSafeReference reference = std::move(_reference);
+        auto resolved = reference.resolve<realm::Results>(realm->_realm);
+        if (realm->_realm->read_transaction_version() == _materializedVersion) {
+            return [results resolveInRealm:realm];
+        }
+        return [RLMResults resultsWithObjectInfo:realm->_info[results.objectClassName]
+                                         results:std::move(resolved)];
+    });
+}
+
+- (BOOL)isInvalidated {
+    return !_reference && !_materializedResults;
+}
+
+@end
+
+@implementation RLMThreadSafeBatchReference {
+    // A reference to the results for one of the types, which pins the source
+    // version and refreshes the target Realm to it when resolved
+    realm::ThreadSafeReference _reference;
+    std::string _path;
+    NSMutableArray<NSString *> *_classNames;
+    std::vector<std::pair<uint32_t, realm::ObjKey>> _keys;
+}
+
+- (instancetype)initWithObjects:(id<NSFastEnumeration>)objects {
+    if (!(self = [super init])) {
+        return nil;
+    }
+    _classNames = [NSMutableArray new];
+
+    RLMRealm *realm;
+    auto setRealm = [&](RLMRealm *objectRealm) {
+        if (!realm) {
+            realm = objectRealm;
+        }
+        else if (realm != objectRealm) {
+            @throw RLMException(@"Cannot construct a batch reference to objects managed by different Realms.");
+        }
+    };
+
+    if ([(id)objects isKindOfClass:[RLMResults class]]) {
+        RLMResults *results = (RLMResults *)objects;
+        if (!results.realm) {
+            @throw RLMException(@"Cannot construct reference to unmanaged object, "
+                                "which can be passed across threads directly");
+        }
+        if (results.type != RLMPropertyTypeObject) {
+            @throw RLMException(@"Cannot construct a batch reference to results of type '%@'.",
+                                RLMTypeToString(results.type));
+        }
+        setRealm(results.realm);
+        [_classNames addObject:results.objectClassName];
+        std::vector<realm::ObjKey> keys = [results objectKeys];
+        _keys.reserve(keys.size());
+        for (auto key : keys) {
+            _keys.emplace_back(0, key);
+        }
+    }
+    else {
+        NSString *lastClassName;
+        uint32_t classIndex = 0;
+        for (RLMObjectBase *obj in objects) {
+            if (![obj isKindOfClass:[RLMObjectBase class]]) {
+                @throw RLMException(@"Cannot construct a batch reference to '%@', which is not a Realm object.",
+                                    obj);
+            }
+            if (obj.invalidated) {
+                @throw RLMException(@"Cannot construct reference to invalidated object");
+            }
+            if (!obj->_realm) {
+                @throw RLMException(@"Cannot construct reference to unmanaged object, "
+                                    "which can be passed across threads directly");
+            }
+            setRealm(obj->_realm);
+
+            NSString *className = obj->_objectSchema.className;
+            if (![className isEqualToString:lastClassName]) {
+                NSUInteger index = [_classNames indexOfObject:className];
+                if (index == NSNotFound) {
+                    index = _classNames.count;
+                    [_classNames addObject:className];
+                }
+                classIndex = static_cast<uint32_t>(index);
+                lastClassName = className;
+            }
+            _keys.emplace_back(classIndex, obj->_row.get_key());
+        }
+    }
+
+    if (realm) {
+        [realm verifyThread];
+        _path = realm->_realm->config().path;
+        RLMTranslateError([&] {
+            _reference = realm::Results(realm->_realm, realm->_info[_classNames.firstObject].table());
+        });
+    }
+    return self;
+}
+
++ (instancetype)referenceWithObjects:(id<NSFastEnumeration>)objects {
+    return [[self alloc] initWithObjects:objects];
+}
+
+- (NSUInteger)count {
+    return _keys.size();
+}
+
 - (BOOL)isInvalidated {
-    return !_reference;
+    return !_classNames;
+}
+
+- (NSArray *)resolveReferenceInRealm:(RLMRealm *)realm {
+    if (!_classNames) {
+        @throw RLMException(@"Can only resolve a thread safe reference once.");
+    }
+    if (!_path.empty() && realm->_realm->config().path != _path) {
+        @throw RLMException(@"Cannot resolve a thread safe reference in a different Realm file.");
+    }
+    NSArray<NSString *> *classNames = _classNames;
+    _classNames = nil;
+    if (_keys.empty()) {
+        return @[];
+    }
+
+    return RLMTranslateError([&] {
+        // Resolving the reference advances the target Realm to at least the
+        // source version, after which the objects which still exist are found
+        // by key without creating accessors for them
+        realm::ThreadSafeReference reference = std::move(_reference);
+        reference.resolve<realm::Results>(realm->_realm);
+
+        std::vector<RLMClassInfo *> infos;
+        std::vector<realm::TableRef> tables;
+        for (NSString *className in classNames) {
+            RLMClassInfo& info = realm->_info[className];
+            infos.push_back(&info);
+            tables.push_back(info.table());
+        }
+
+        std::vector<std::pair<uint32_t, realm::ObjKey>> keys;
+        keys.reserve(_keys.size());
+        for (auto& key : _keys) {
+            if (tables[key.first]->is_valid(key.second)) {
+                keys.push_back(key);
+            }
+        }
+        return [[RLMObjectKeyArray alloc] initWithRealm:realm infos:std::move(infos) keys:std::move(keys)
+                                           cacheObjects:true];
+    });
 }
 
 @end
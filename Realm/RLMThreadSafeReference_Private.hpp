@@ -42,4 +42,10 @@ NS_ASSUME_NONNULL_BEGIN
 
 @end
 
+@interface RLMThreadSafeBatchReference ()
+
+- (NSArray *)resolveReferenceInRealm:(RLMRealm *)realm;
+
+@end
+
 NS_ASSUME_NONNULL_END
@@ -48,6 +48,9 @@ typedef void(^RLMUserCustomDataBlock)(NSDictionary * _Nullable, NSError * _Nulla
 /// A block type for returning from function calls.
 typedef void(^RLMCallFunctionCompletionBlock)(id<RLMBSON> _Nullable, NSError * _Nullable);
 
+/// A block type for returning from function calls as binary BSON.
+typedef void(^RLMCallFunctionDataCompletionBlock)(NSData * _Nullable, NSError * _Nullable);
+
 NS_ASSUME_NONNULL_BEGIN
 
 /**
@@ -193,6 +196,26 @@ NS_ASSUME_NONNULL_BEGIN
                 arguments:(NSArray<id<RLMBSON>> *)arguments
           completionBlock:(RLMCallFunctionCompletionBlock)completion NS_REFINED_FOR_SWIFT;
 
+/**
+ Calls the MongoDB Realm function with the provided name and arguments, which
+ are passed as binary BSON rather than as `RLMBSON` objects.
+
+ This avoids creating an Objective-C object for each value in the arguments and
+ the response, which can be much faster for large payloads.
+
+ @param name The name of the MongoDB Realm function to be called.
+ @param arguments A BSON array of the arguments to be provided to the function,
+                  encoded as a BSON document whose keys are the array indices.
+ @param completion The completion handler to call when the function call is complete.
+ The response is encoded as a BSON document with a single field named `value`
+ which holds the function's return value, whatever its type. This handler is
+ executed on a non-main global `DispatchQueue`.
+*/
+- (void)callFunctionNamed:(NSString *)name
+            argumentsData:(NSData *)arguments
+          completionBlock:(RLMCallFunctionDataCompletionBlock)completion
+    NS_SWIFT_NAME(callFunction(named:argumentsData:_:));
+
 /// :nodoc:
 - (instancetype)init __attribute__((unavailable("RLMUser cannot be created directly")));
 /// :nodoc:
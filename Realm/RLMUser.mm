@@ -244,15 +244,48 @@ using namespace realm;
         args.push_back(RLMConvertRLMBSONToBson(argument));
     }
 
-    _app._realmApp->call_function(_user,
-                        std::string(name.UTF8String),
-                        args, [completionBlock](util::Optional<app::AppError> error,
-                                                util::Optional<bson::Bson> response) {
+    [self callFunctionNamed:name bsonArguments:args
+                 completion:[completionBlock](const util::Optional<app::AppError>& error,
+                                              const util::Optional<bson::Bson>& response) {
         if (error) {
             return completionBlock(nil, RLMAppErrorToNSError(*error));
         }
 
         completionBlock(RLMConvertBsonToRLMBSON(*response), nil);
+    }];
+}
+
+- (void)callFunctionNamed:(NSString *)name
+            argumentsData:(NSData *)arguments
+          completionBlock:(RLMCallFunctionDataCompletionBlock)completionBlock {
+    [self callFunctionNamed:name bsonArguments:RLMBsonArrayWithData(arguments)
+                 completion:[completionBlock](const util::Optional<app::AppError>& error,
+                                              const util::Optional<bson::Bson>& response) {
+        if (error) {
+            return completionBlock(nil, RLMAppErrorToNSError(*error));
+        }
+
+        completionBlock(RLMFunctionResponseData(*response), nil);
+    }];
+}
+
+- (void)callFunctionNamed:(NSString *)name
+            bsonArguments:(bson::BsonArray const&)args
+               completion:(RLMAppResponseCache::Callback)completion {
+    std::string functionName = name.UTF8String;
+    auto makeKey = [&] {
+        std::stringstream s;
+        s << "call\n" << _user->identity() << "\n" << functionName << "\n" << bson::Bson(args);
+        return s.str();
+    };
+    auto realmApp = _app._realmApp;
+    auto user = _user;
+    _app._responseCache->perform(makeKey, std::move(completion), [&](RLMAppResponseCache::Callback callback) {
+        realmApp->call_function(user, functionName, args,
+                                [callback = std::move(callback)](util::Optional<app::AppError> error,
+                                                                 util::Optional<bson::Bson> response) {
+            callback(error, response);
+        });
     });
 }
 
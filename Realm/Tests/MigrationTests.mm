@@ -19,6 +19,7 @@
 #import "RLMTestCase.h"
 
 #import "RLMMigration.h"
+#import "RLMMigration_Private.h"
 #import "RLMObjectSchema_Private.hpp"
 #import "RLMObjectStore.h"
 #import "RLMObject_Private.h"
@@ -100,6 +101,14 @@ RLM_COLLECTION_TYPE(MigrationTestObject);
 @implementation MigrationTwoStringObject
 @end
 
+@interface MigrationFloatingPointObject : RLMObject
+@property float floatCol;
+@property double doubleCol;
+@end
+
+@implementation MigrationFloatingPointObject
+@end
+
 @interface MigrationLinkObject : RLMObject
 @property MigrationTestObject *object;
 @property RLMArray<MigrationTestObject> *array;
@@ -113,6 +122,40 @@ RLM_COLLECTION_TYPE(MigrationTestObject);
 @interface MigrationTests : RLMTestCase
 @end
 
+struct SumColumnContext {
+    int calls = 0;
+    NSUInteger inputCount = 0;
+    NSUInteger outputCount = 0;
+};
+
+static void sumColumnFunction(void *context, NSUInteger count,
+                              const RLMMigrationColumnBuffer *inputs, NSUInteger inputCount,
+                              RLMMigrationColumnBuffer *outputs, NSUInteger outputCount) {
+    auto& ctx = *static_cast<SumColumnContext *>(context);
+    ++ctx.calls;
+    ctx.inputCount = inputCount;
+    ctx.outputCount = outputCount;
+    if (inputCount != 2 || outputCount != 1) {
+        return;
+    }
+    auto lhs = static_cast<const int64_t *>(inputs[0].values);
+    auto rhs = static_cast<const int64_t *>(inputs[1].values);
+    auto out = static_cast<int64_t *>(outputs[0].values);
+    for (NSUInteger i = 0; i < count; ++i) {
+        out[i] = lhs[i] + rhs[i];
+    }
+}
+
+static void infiniteDateColumnFunction(void *, NSUInteger count,
+                                       const RLMMigrationColumnBuffer *, NSUInteger,
+                                       RLMMigrationColumnBuffer *outputs, NSUInteger) {
+    auto out = static_cast<double *>(outputs[0].values);
+    for (NSUInteger i = 0; i < count; ++i) {
+        outputs[0].isNull[i] = false;
+        out[i] = INFINITY;
+    }
+}
+
 @interface DateMigrationObject : RLMObject
 @property (nonatomic, strong) NSDate *nonNullNonIndexed;
 @property (nonatomic, strong) NSDate *nullNonIndexed;
@@ -1623,6 +1666,465 @@ RLM_COLLECTION_TYPE(MigrationTestObject);
     XCTAssertEqual(parentEnumerateCalls, 2);
 }
 
+#pragma mark - Bulk Property Operations
+
+- (void)testConvertPropertyType {
+    RLMObjectSchema *objectSchema = [RLMObjectSchema schemaForObjectClass:MigrationTestObject.class];
+    objectSchema.objectClass = RLMObject.class;
+    RLMProperty *stringCol = objectSchema.properties[1];
+    stringCol.type = RLMPropertyTypeInt;
+    stringCol.optional = NO;
+
+    [self createTestRealmWithSchema:@[objectSchema] block:^(RLMRealm *realm) {
+        for (int i = 0; i < 2000; ++i) {
+            [realm createObject:MigrationTestObject.className withValue:@[@(i), @(i * 2)]];
+        }
+    }];
+
+    RLMRealm *realm = [self migrateTestRealmWithBlock:^(RLMMigration *migration, uint64_t) {
+        [migration convertPropertyForClass:MigrationTestObject.className property:@"stringCol"];
+    }];
+
+    RLMResults<MigrationTestObject *> *objects = [MigrationTestObject allObjectsInRealm:realm];
+    XCTAssertEqual(objects.count, 2000U);
+    XCTAssertEqualObjects(objects[1].stringCol, @"2");
+    XCTAssertEqualObjects(objects[1999].stringCol, @"3998");
+}
+
+- (void)testCopyPropertyConvertsStringsToInts {
+    RLMObjectSchema *objectSchema = [RLMObjectSchema schemaForObjectClass:MigrationTestObject.class];
+    objectSchema.objectClass = RLMObject.class;
+    RLMProperty *intCol = objectSchema.properties[0];
+    intCol.type = RLMPropertyTypeString;
+    intCol.optional = NO;
+
+    [self createTestRealmWithSchema:@[objectSchema] block:^(RLMRealm *realm) {
+        [realm createObject:MigrationTestObject.className withValue:@[@"1", @"a"]];
+        [realm createObject:MigrationTestObject.className withValue:@[@"-20", @"b"]];
+    }];
+
+    RLMRealm *realm = [self migrateTestRealmWithBlock:^(RLMMigration *migration, uint64_t) {
+        [migration copyPropertyForClass:MigrationTestObject.className oldName:@"intCol" newName:@"intCol"];
+    }];
+
+    RLMResults<MigrationTestObject *> *objects = [MigrationTestObject allObjectsInRealm:realm];
+    XCTAssertEqual(objects[0].intCol, 1);
+    XCTAssertEqual(objects[1].intCol, -20);
+    XCTAssertEqualObjects(objects[1].stringCol, @"b");
+}
+
+- (void)testConvertPropertyWithInvalidValueThrows {
+    RLMObjectSchema *objectSchema = [RLMObjectSchema schemaForObjectClass:MigrationTestObject.class];
+    objectSchema.objectClass = RLMObject.class;
+    RLMProperty *intCol = objectSchema.properties[0];
+    intCol.type = RLMPropertyTypeString;
+    intCol.optional = NO;
+
+    [self createTestRealmWithSchema:@[objectSchema] block:^(RLMRealm *realm) {
+        [realm createObject:MigrationTestObject.className withValue:@[@"1x", @"a"]];
+    }];
+
+    [self migrateTestRealmWithBlock:^(RLMMigration *migration, uint64_t) {
+        RLMAssertThrowsWithReasonMatching([migration convertPropertyForClass:MigrationTestObject.className
+                                                                    property:@"intCol"],
+                                          @"Cannot convert value '1x' to type 'int'");
+        RLMAssertThrowsWithReasonMatching([migration convertPropertyForClass:MigrationTestObject.className
+                                                                    property:@"missing"],
+                                          @"Invalid property name");
+    }];
+}
+
+- (void)testConvertPropertyRejectsLossOfPrecision {
+    RLMObjectSchema *objectSchema = [RLMObjectSchema schemaForObjectClass:MigrationFloatingPointObject.class];
+    objectSchema.objectClass = RLMObject.class;
+    objectSchema.properties[0].type = RLMPropertyTypeDouble;
+    objectSchema.properties[1].type = RLMPropertyTypeInt;
+
+    [self createTestRealmWithSchema:@[objectSchema] block:^(RLMRealm *realm) {
+        [realm createObject:MigrationFloatingPointObject.className withValue:@[@0.1, @((1LL << 53) + 1)]];
+    }];
+
+    [self migrateTestRealmWithBlock:^(RLMMigration *migration, uint64_t) {
+        RLMAssertThrowsWithReasonMatching([migration convertPropertyForClass:MigrationFloatingPointObject.className
+                                                                    property:@"floatCol"],
+                                          @"Cannot convert value '0.1' to type 'float'");
+        RLMAssertThrowsWithReasonMatching([migration convertPropertyForClass:MigrationFloatingPointObject.className
+                                                                    property:@"doubleCol"],
+                                          @"Cannot convert value '9007199254740993' to type 'double'");
+    }];
+}
+
+- (void)testTransformProperties {
+    [self createTestRealmWithClasses:@[ThreeFieldMigrationTestObject.class] block:^(RLMRealm *realm) {
+        for (int i = 0; i < 3000; ++i) {
+            [ThreeFieldMigrationTestObject createInRealm:realm withValue:@[@(i), @(i * 10), @0]];
+        }
+    }];
+
+    __block SumColumnContext context;
+    RLMRealm *realm = [self migrateTestRealmWithBlock:^(RLMMigration *migration, uint64_t) {
+        [migration transformPropertiesForClass:ThreeFieldMigrationTestObject.className
+                                 oldProperties:@[@"col1", @"col2"]
+                                 newProperties:@[@"col3"]
+                                      function:sumColumnFunction
+                                       context:&context];
+    }];
+
+    // 3000 rows are processed in batches of at most 1024
+    XCTAssertEqual(context.calls, 3);
+    XCTAssertEqual(context.inputCount, 2U);
+    XCTAssertEqual(context.outputCount, 1U);
+    RLMResults<ThreeFieldMigrationTestObject *> *objects = [ThreeFieldMigrationTestObject allObjectsInRealm:realm];
+    XCTAssertEqual(objects.count, 3000U);
+    for (ThreeFieldMigrationTestObject *obj in objects) {
+        XCTAssertEqual(obj.col3, obj.col1 * 11);
+    }
+}
+
+#pragma mark - Chunked Migrations
+
+- (RLMRealmConfiguration *)chunkedMigrationConfigWithBlock:(RLMChunkedMigrationBlock)block {
+    RLMRealmConfiguration *config = self.config;
+    config.customSchema = [self schemaWithObjects:@[[RLMObjectSchema schemaForObjectClass:MigrationTestObject.class]]];
+    config.schemaVersion = 1;
+    config.migrationChunkSize = 1000;
+    if (block) {
+        config.chunkedMigrationBlocks = @{MigrationTestObject.className: block};
+    }
+    return config;
+}
+
+- (void)createMigrationTestObjects:(int)count {
+    [self createTestRealmWithClasses:@[MigrationTestObject.class] block:^(RLMRealm *realm) {
+        for (int i = 0; i < count; ++i) {
+            [MigrationTestObject createInRealm:realm withValue:@[@(i), @""]];
+        }
+    }];
+}
+
+- (void)testChunkedMigration {
+    [self createMigrationTestObjects:2500];
+
+    RLMRealmConfiguration *config = [self chunkedMigrationConfigWithBlock:^(RLMObject *object, uint64_t oldSchemaVersion) {
+        XCTAssertEqual(oldSchemaVersion, 0U);
+        MigrationTestObject *obj = (MigrationTestObject *)object;
+        obj.stringCol = @(obj.intCol).stringValue;
+    }];
+    NSMutableArray *progress = [NSMutableArray new];
+    config.migrationProgressBlock = ^(NSUInteger migrated, NSUInteger total) {
+        XCTAssertEqual(total, 2500U);
+        [progress addObject:@(migrated)];
+    };
+
+    RLMRealm *realm = [RLMRealm realmWithConfiguration:config error:nil];
+    XCTAssertEqualObjects(progress, (@[@1000, @2000, @2500]));
+    for (MigrationTestObject *obj in [MigrationTestObject allObjectsInRealm:realm]) {
+        XCTAssertEqualObjects(obj.stringCol, @(obj.intCol).stringValue);
+    }
+}
+
+- (void)testChunkedMigrationResumesAfterInterruption {
+    [self createMigrationTestObjects:2500];
+
+    __block int calls = 0;
+    @autoreleasepool {
+        RLMRealmConfiguration *config = [self chunkedMigrationConfigWithBlock:^(RLMObject *object, uint64_t) {
+            if (++calls == 1500) {
+                @throw [NSException exceptionWithName:@"Interrupted" reason:@"interrupted" userInfo:nil];
+            }
+            object[@"stringCol"] = @"migrated";
+        }];
+        RLMAssertThrowsWithReasonMatching([RLMRealm realmWithConfiguration:config error:nil], @"interrupted");
+    }
+
+    @autoreleasepool {
+        // Opening without the required block fails rather than exposing the
+        // partially-migrated data
+        NSError *error;
+        XCTAssertNil([RLMRealm realmWithConfiguration:[self chunkedMigrationConfigWithBlock:nil] error:&error]);
+        XCTAssertEqual(error.code, RLMErrorSchemaMismatch);
+
+        // Dynamic Realms can't run the migration blocks and so also can't be opened
+        RLMRealmConfiguration *dynamicConfig = [self chunkedMigrationConfigWithBlock:nil];
+        dynamicConfig.dynamic = YES;
+        error = nil;
+        XCTAssertNil([RLMRealm realmWithConfiguration:dynamicConfig error:&error]);
+        XCTAssertEqual(error.code, RLMErrorSchemaMismatch);
+    }
+
+    calls = 0;
+    RLMRealmConfiguration *config = [self chunkedMigrationConfigWithBlock:^(RLMObject *object, uint64_t) {
+        ++calls;
+        object[@"stringCol"] = @"migrated";
+    }];
+    RLMRealm *realm = [RLMRealm realmWithConfiguration:config error:nil];
+    // Only the objects after the first committed chunk are migrated again
+    XCTAssertEqual(calls, 1500);
+    XCTAssertEqual([MigrationTestObject objectsInRealm:realm where:@"stringCol = 'migrated'"].count, 2500U);
+}
+
+- (void)testOtherRealmsCanBeOpenedDuringChunkedMigration {
+    [self createMigrationTestObjects:2500];
+
+    RLMRealmConfiguration *otherConfig = [RLMRealmConfiguration new];
+    otherConfig.inMemoryIdentifier = @"other";
+    otherConfig.objectClasses = @[MigrationTestObject.class];
+
+    __block int opened = 0;
+    RLMRealmConfiguration *config = [self chunkedMigrationConfigWithBlock:^(RLMObject *object, uint64_t) {
+        object[@"stringCol"] = @"migrated";
+    }];
+    config.migrationProgressBlock = ^(NSUInteger, NSUInteger) {
+        // Open the other Realm on a background thread so that it isn't simply
+        // returned from this thread's cache
+        dispatch_sync(dispatch_get_global_queue(0, 0), ^{
+            @autoreleasepool {
+                if ([RLMRealm realmWithConfiguration:otherConfig error:nil]) {
+                    ++opened;
+                }
+            }
+        });
+    };
+
+    RLMRealm *realm = [RLMRealm realmWithConfiguration:config error:nil];
+    XCTAssertEqual(opened, 3);
+    XCTAssertEqual([MigrationTestObject objectsInRealm:realm where:@"stringCol = 'migrated'"].count, 2500U);
+}
+
+#pragma mark - Lazy Property Migrations
+
+- (RLMRealmConfiguration *)lazyMigrationConfigWithBlock:(RLMLazyPropertyMigrationBlock)block {
+    RLMRealmConfiguration *config = self.config;
+    config.customSchema = [self schemaWithObjects:@[[RLMObjectSchema schemaForObjectClass:MigrationTestObject.class]]];
+    config.schemaVersion = 1;
+    config.migrationChunkSize = 1000;
+    config.lazyPropertyMigrationBlocks = @{@"MigrationTestObject.stringCol": block};
+    return config;
+}
+
+- (void)createLazyMigrationTestObjects:(int)count {
+    // Create the objects with a schema which does not yet have stringCol
+    RLMObjectSchema *objectSchema = [RLMObjectSchema schemaForObjectClass:MigrationTestObject.class];
+    objectSchema.properties = @[objectSchema.properties[0]];
+    [self createTestRealmWithSchema:@[objectSchema] block:^(RLMRealm *realm) {
+        for (int i = 0; i < count; ++i) {
+            [MigrationTestObject createInRealm:realm withValue:@[@(i)]];
+        }
+    }];
+}
+
+- (void)testLazyPropertyMigrationComputesValuesOnRead {
+    [self createLazyMigrationTestObjects:2500];
+
+    __block int calls = 0;
+    RLMRealmConfiguration *config = [self lazyMigrationConfigWithBlock:^id(RLMObject *object) {
+        ++calls;
+        return [object[@"intCol"] stringValue];
+    }];
+    RLMSetLazyMigrationSweepEnabled(false);
+    RLMRealm *realm = [RLMRealm realmWithConfiguration:config error:nil];
+    RLMSetLazyMigrationSweepEnabled(true);
+    XCTAssertEqual(calls, 0);
+
+    RLMResults *objects = [MigrationTestObject allObjectsInRealm:realm];
+    MigrationTestObject *obj = objects[10];
+    XCTAssertEqualObjects(obj.stringCol, @"10");
+    XCTAssertEqualObjects(obj[@"stringCol"], @"10");
+    XCTAssertEqual(calls, 2);
+
+    RLMAssertThrowsWithReasonMatching([MigrationTestObject objectsInRealm:realm where:@"stringCol = '10'"],
+                                      @"until its lazy migration has completed");
+    RLMAssertThrowsWithReasonMatching([objects sortedResultsUsingKeyPath:@"stringCol" ascending:YES],
+                                      @"until its lazy migration has completed");
+    RLMAssertThrowsWithReasonMatching([objects distinctResultsUsingKeyPaths:@[@"stringCol"]],
+                                      @"until its lazy migration has completed");
+    RLMAssertThrowsWithReasonMatching([objects maxOfProperty:@"stringCol"],
+                                      @"until its lazy migration has completed");
+    RLMAssertThrowsWithReasonMatching([objects valueForKey:@"stringCol"],
+                                      @"until its lazy migration has completed");
+    XCTAssertEqual([[objects valueForKey:@"intCol"] count], 2500U);
+
+    // Encoding objects as BSON uses the migrated values
+    const uint8_t bytes[] = {
+        39, 0, 0, 0,
+        0x12, 'i', 'n', 't', 'C', 'o', 'l', 0, 10, 0, 0, 0, 0, 0, 0, 0,
+        0x02, 's', 't', 'r', 'i', 'n', 'g', 'C', 'o', 'l', 0, 3, 0, 0, 0, '1', '0', 0,
+        0
+    };
+    XCTAssertEqualObjects(obj.bsonDocument, [NSData dataWithBytes:bytes length:sizeof(bytes)]);
+    XCTAssertEqual(calls, 3);
+
+    // Frozen objects also compute the migrated values
+    MigrationTestObject *frozen = [objects[20] freeze];
+    XCTAssertEqualObjects(frozen.stringCol, @"20");
+    XCTAssertEqual(calls, 4);
+
+    XCTAssertTrue(RLMRunLazyMigrationSweep(realm, config, nil));
+    XCTAssertEqual(calls, 2504);
+
+    // The stored values are used once the sweep has completed
+    XCTAssertEqualObjects(obj.stringCol, @"10");
+    XCTAssertEqual(calls, 2504);
+    XCTAssertEqual([MigrationTestObject objectsInRealm:realm where:@"stringCol = '10'"].count, 1U);
+}
+
+- (void)testOpeningRealmWithPendingLazyMigrationRequiresBlock {
+    [self createLazyMigrationTestObjects:10];
+
+    RLMSetLazyMigrationSweepEnabled(false);
+    @autoreleasepool {
+        RLMRealmConfiguration *config = [self lazyMigrationConfigWithBlock:^id(RLMObject *object) {
+            return [object[@"intCol"] stringValue];
+        }];
+        XCTAssertNotNil([RLMRealm realmWithConfiguration:config error:nil]);
+    }
+    RLMSetLazyMigrationSweepEnabled(true);
+
+    // Opening without the block fails rather than exposing the stored values
+    RLMRealmConfiguration *config = [self lazyMigrationConfigWithBlock:^id(RLMObject *) { return nil; }];
+    config.lazyPropertyMigrationBlocks = @{};
+    NSError *error;
+    XCTAssertNil([RLMRealm realmWithConfiguration:config error:&error]);
+    XCTAssertEqual(error.code, RLMErrorSchemaMismatch);
+
+    config.dynamic = YES;
+    error = nil;
+    XCTAssertNil([RLMRealm realmWithConfiguration:config error:&error]);
+    XCTAssertEqual(error.code, RLMErrorSchemaMismatch);
+}
+
+- (void)testLazyPropertyMigrationSweepResumesAfterInterruption {
+    [self createLazyMigrationTestObjects:2500];
+
+    __block int calls = 0;
+    RLMRealmConfiguration *config = [self lazyMigrationConfigWithBlock:^id(RLMObject *object) {
+        if (++calls == 1500) {
+            @throw [NSException exceptionWithName:@"Interrupted" reason:@"interrupted" userInfo:nil];
+        }
+        return [object[@"intCol"] stringValue];
+    }];
+    RLMSetLazyMigrationSweepEnabled(false);
+    RLMRealm *realm = [RLMRealm realmWithConfiguration:config error:nil];
+    RLMSetLazyMigrationSweepEnabled(true);
+    RLMAssertThrowsWithReasonMatching(RLMRunLazyMigrationSweep(realm, config, nil), @"interrupted");
+
+    // Only the objects after the first committed chunk are still computed on read
+    calls = 0;
+    RLMResults *objects = [MigrationTestObject allObjectsInRealm:realm];
+    XCTAssertEqualObjects([objects[999] stringCol], @"999");
+    XCTAssertEqual(calls, 0);
+    XCTAssertEqualObjects([objects[1000] stringCol], @"1000");
+    XCTAssertEqual(calls, 1);
+
+    XCTAssertTrue(RLMRunLazyMigrationSweep(realm, config, nil));
+    XCTAssertEqual(calls, 1501);
+    XCTAssertEqual([MigrationTestObject objectsInRealm:realm where:@"stringCol != nil"].count, 2500U);
+}
+
+- (void)testLazyPropertyMigrationKeepsValuesWrittenDuringSweep {
+    [self createLazyMigrationTestObjects:2500];
+
+    __block int calls = 0;
+    RLMRealmConfiguration *config = [self lazyMigrationConfigWithBlock:^id(RLMObject *object) {
+        if (++calls == 1500) {
+            @throw [NSException exceptionWithName:@"Interrupted" reason:@"interrupted" userInfo:nil];
+        }
+        return [object[@"intCol"] stringValue];
+    }];
+    RLMSetLazyMigrationSweepEnabled(false);
+    RLMRealm *realm = [RLMRealm realmWithConfiguration:config error:nil];
+    RLMSetLazyMigrationSweepEnabled(true);
+    RLMAssertThrowsWithReasonMatching(RLMRunLazyMigrationSweep(realm, config, nil), @"interrupted");
+
+    RLMResults *objects = [MigrationTestObject allObjectsInRealm:realm];
+    MigrationTestObject *swept = objects[10];
+    MigrationTestObject *pending = objects[2000];
+    [realm transactionWithBlock:^{
+        // Objects created after the migration was scheduled store the value
+        // they're given rather than the computed one
+        [MigrationTestObject createInRealm:realm withValue:@[@5000, @"created"]];
+        MigrationTestObject *created = [[MigrationTestObject alloc] initWithValue:@[@5001]];
+        [realm addObject:created];
+        created.stringCol = @"set";
+
+        swept.stringCol = @"swept";
+        RLMAssertThrowsWithReasonMatching(pending.stringCol = @"pending",
+                                          @"Cannot set property 'MigrationTestObject.stringCol' until its lazy migration has completed");
+        RLMAssertThrowsWithReasonMatching(pending[@"stringCol"] = @"pending",
+                                          @"until its lazy migration has completed");
+    }];
+
+    calls = 0;
+    XCTAssertEqualObjects([objects[2500] stringCol], @"created");
+    XCTAssertEqualObjects([objects[2501] stringCol], @"set");
+    XCTAssertEqual(calls, 0);
+
+    XCTAssertTrue(RLMRunLazyMigrationSweep(realm, config, nil));
+    XCTAssertEqual(calls, 1500);
+    XCTAssertEqualObjects(swept.stringCol, @"swept");
+    XCTAssertEqualObjects(pending.stringCol, @"2000");
+    XCTAssertEqualObjects([objects[2500] stringCol], @"created");
+    XCTAssertEqualObjects([objects[2501] stringCol], @"set");
+
+    // Once swept the property can be set
+    [realm transactionWithBlock:^{
+        pending.stringCol = @"pending";
+    }];
+    XCTAssertEqualObjects(pending.stringCol, @"pending");
+}
+
+- (void)testQueryingThroughLinksToPendingLazyMigrationThrows {
+    RLMObjectSchema *objectSchema = [RLMObjectSchema schemaForObjectClass:MigrationTestObject.class];
+    objectSchema.properties = @[objectSchema.properties[0]];
+    RLMObjectSchema *linkSchema = [RLMObjectSchema schemaForObjectClass:MigrationLinkObject.class];
+    [self createTestRealmWithSchema:@[objectSchema, linkSchema] block:^(RLMRealm *realm) {
+        [MigrationLinkObject createInRealm:realm withValue:@[@[@1], @[@[@2]], @[@[@3]], @{@"a": @[@4]}]];
+    }];
+
+    RLMRealmConfiguration *config = [self lazyMigrationConfigWithBlock:^id(RLMObject *object) {
+        return [object[@"intCol"] stringValue];
+    }];
+    config.customSchema = [self schemaWithObjects:@[[RLMObjectSchema schemaForObjectClass:MigrationTestObject.class],
+                                                    [RLMObjectSchema schemaForObjectClass:MigrationLinkObject.class]]];
+    RLMSetLazyMigrationSweepEnabled(false);
+    RLMRealm *realm = [RLMRealm realmWithConfiguration:config error:nil];
+    RLMSetLazyMigrationSweepEnabled(true);
+
+    for (NSString *predicate in @[@"object.stringCol = '1'", @"ANY array.stringCol = '2'",
+                                  @"ANY set.stringCol = '3'", @"ANY dictionary.stringCol = '4'",
+                                  @"SUBQUERY(array, $o, $o.stringCol = '2').@count > 0"]) {
+        RLMAssertThrowsWithReasonMatching([MigrationLinkObject objectsInRealm:realm where:predicate],
+                                          @"'MigrationTestObject.stringCol' until its lazy migration has completed");
+    }
+    RLMResults *objects = [MigrationLinkObject allObjectsInRealm:realm];
+    RLMAssertThrowsWithReasonMatching([objects sortedResultsUsingKeyPath:@"object.stringCol" ascending:YES],
+                                      @"until its lazy migration has completed");
+
+    // Properties which are not pending can still be used through the same links
+    XCTAssertEqual([MigrationLinkObject objectsInRealm:realm where:@"object.intCol = 1"].count, 1U);
+    XCTAssertEqual([MigrationLinkObject objectsInRealm:realm where:@"ANY array.intCol = 2"].count, 1U);
+    XCTAssertEqual([MigrationLinkObject objectsInRealm:realm where:@"array.@count = 1"].count, 1U);
+
+    XCTAssertTrue(RLMRunLazyMigrationSweep(realm, config, nil));
+    XCTAssertEqual([MigrationLinkObject objectsInRealm:realm where:@"object.stringCol = '1'"].count, 1U);
+    XCTAssertEqual([MigrationLinkObject objectsInRealm:realm where:@"ANY array.stringCol = '2'"].count, 1U);
+}
+
+- (void)testTransformPropertiesWithInvalidDateThrows {
+    [self createTestRealmWithClasses:@[DateMigrationObject.class] block:^(RLMRealm *realm) {
+        [DateMigrationObject createInRealm:realm withValue:@[NSDate.date, NSNull.null, NSDate.date, NSNull.null, @1]];
+    }];
+
+    [self migrateTestRealmWithBlock:^(RLMMigration *migration, uint64_t) {
+        RLMAssertThrowsWithReasonMatching([migration transformPropertiesForClass:DateMigrationObject.className
+                                                                   oldProperties:@[@"cookie"]
+                                                                   newProperties:@[@"nonNullNonIndexed"]
+                                                                        function:infiniteDateColumnFunction
+                                                                         context:nil],
+                                          @"invalid date inf for property 'nonNullNonIndexed'");
+    }];
+}
+
 #pragma mark - Property Rename
 
 // Successful Property Rename Tests
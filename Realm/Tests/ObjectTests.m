@@ -236,6 +236,77 @@ RLM_COLLECTION_TYPE(CycleObject)
     XCTAssertNil(obj0[@"name"]);
 }
 
+- (void)testValueForLinkPath {
+    OwnerObject *unmanaged = [[OwnerObject alloc] initWithValue:@[@"owner", @[@"dog", @5]]];
+    XCTAssertEqualObjects([unmanaged valueForLinkPath:@"dog.dogName"], @"dog");
+
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    [realm beginWriteTransaction];
+    OwnerObject *owner = [OwnerObject createInRealm:realm withValue:@[@"owner", @[@"dog", @5]]];
+    OwnerObject *noDog = [OwnerObject createInRealm:realm withValue:@[@"no dog", NSNull.null]];
+    [realm commitWriteTransaction];
+
+    XCTAssertEqualObjects([owner valueForLinkPath:@"name"], @"owner");
+    XCTAssertEqualObjects([owner valueForLinkPath:@"dog.dogName"], @"dog");
+    XCTAssertEqualObjects([owner valueForLinkPath:@"dog.age"], @5);
+    XCTAssertEqualObjects([[owner valueForLinkPath:@"dog.owners"] valueForKey:@"name"], @[@"owner"]);
+    XCTAssertNil([noDog valueForLinkPath:@"dog.dogName"]);
+
+    RLMAssertThrowsWithReason([owner valueForLinkPath:@"dog.invalid"],
+                              @"Invalid property name 'invalid' for class 'DogObject'.");
+    RLMAssertThrowsWithReason([owner valueForLinkPath:@"name.length"],
+                              @"must be a link to a single object");
+}
+
+- (void)testBsonDocument {
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    [realm beginWriteTransaction];
+    IntObject *intObject = [IntObject createInRealm:realm withValue:@[@5]];
+    [IntObject createInRealm:realm withValue:@[@6]];
+    EmbeddedIntParentObject *parent = [EmbeddedIntParentObject createInRealm:realm withValue:@[@1, @[@2], @[]]];
+    [realm commitWriteTransaction];
+
+    const uint8_t intBytes[] = {
+        21, 0, 0, 0,
+        0x12, 'i', 'n', 't', 'C', 'o', 'l', 0, 5, 0, 0, 0, 0, 0, 0, 0,
+        0
+    };
+    XCTAssertEqualObjects(intObject.bsonDocument, [NSData dataWithBytes:intBytes length:sizeof(intBytes)]);
+
+    // Embedded objects are nested documents and lists are arrays
+    const uint8_t parentBytes[] = {
+        58, 0, 0, 0,
+        0x12, 'p', 'k', 0, 1, 0, 0, 0, 0, 0, 0, 0,
+        0x03, 'o', 'b', 'j', 'e', 'c', 't', 0,
+            21, 0, 0, 0,
+            0x12, 'i', 'n', 't', 'C', 'o', 'l', 0, 2, 0, 0, 0, 0, 0, 0, 0,
+            0,
+        0x04, 'a', 'r', 'r', 'a', 'y', 0,
+            5, 0, 0, 0,
+            0,
+        0
+    };
+    XCTAssertEqualObjects(parent.bsonDocument, [NSData dataWithBytes:parentBytes length:sizeof(parentBytes)]);
+
+    // Results are encoded as consecutive documents
+    NSMutableData *expected = [NSMutableData dataWithBytes:intBytes length:sizeof(intBytes)];
+    [expected appendBytes:intBytes length:sizeof(intBytes)];
+    ((uint8_t *)expected.mutableBytes)[sizeof(intBytes) + 12] = 6;
+    XCTAssertEqualObjects([[IntObject allObjectsInRealm:realm] bsonDocumentsForKeyPaths:nil], expected);
+
+    const uint8_t pkBytes[] = {
+        17, 0, 0, 0,
+        0x12, 'p', 'k', 0, 1, 0, 0, 0, 0, 0, 0, 0,
+        0
+    };
+    XCTAssertEqualObjects([[EmbeddedIntParentObject allObjectsInRealm:realm] bsonDocumentsForKeyPaths:@[@"pk"]],
+                          [NSData dataWithBytes:pkBytes length:sizeof(pkBytes)]);
+
+    RLMAssertThrowsWithReason([[IntObject new] bsonDocument], @"Only managed objects can be encoded as BSON.");
+    RLMAssertThrowsWithReason([[IntObject allObjectsInRealm:realm] bsonDocumentsForKeyPaths:@[@"invalid"]],
+                              @"Property 'invalid' not found in object of type 'IntObject'");
+}
+
 - (void)testCannotUpdatePrimaryKey {
     PrimaryIntObject *intObj = [[PrimaryIntObject alloc] init];
     intObj.intCol = 1;
@@ -1442,6 +1513,34 @@ static IntObject *managedObject() {
     }];
 }
 
+- (void)testFrozenObjectsShareAccessorClassWithLiveObjects {
+    RLMRealm *realm = RLMRealm.defaultRealm;
+    [realm beginWriteTransaction];
+    OwnerObject *owner = [OwnerObject createInRealm:realm withValue:@[@"owner", @[@"dog", @5]]];
+    [realm commitWriteTransaction];
+
+    OwnerObject *frozen = [owner freeze];
+    XCTAssertEqual(frozen.class, owner.class);
+    XCTAssertEqual([frozen thaw].class, owner.class);
+
+    RLMResults<OwnerObject *> *frozenResults = [[OwnerObject allObjectsInRealm:realm] freeze];
+    [self dispatchAsyncAndWait:^{
+        XCTAssertEqualObjects(frozen.name, @"owner");
+        XCTAssertEqualObjects(frozen.dog.dogName, @"dog");
+        XCTAssertEqual(frozen.dog.age, 5);
+        XCTAssertTrue(frozen.dog.frozen);
+        XCTAssertEqual(frozen.dog.class, [frozen.dog freeze].class);
+        for (OwnerObject *obj in frozenResults) {
+            XCTAssertEqual(obj.class, frozen.class);
+            XCTAssertEqualObjects(obj.name, @"owner");
+        }
+        // The live object still checks which thread it is read on
+        RLMAssertThrowsWithReasonMatching(owner.name, @"incorrect thread");
+    }];
+
+    RLMAssertThrowsWithReason(frozen.name = @"new", @"Attempting to modify a frozen object");
+}
+
 - (void)testMutateFrozenObject {
     IntObject *obj = managedObject();
     IntObject *frozen = obj.freeze;
@@ -1597,4 +1696,51 @@ static IntObject *managedObject() {
     XCTAssertEqual([[IntObject allObjects] count], 1);
 }
 
+- (void)testFreezeObjects {
+    RLMRealm *realm = RLMRealm.defaultRealm;
+    [realm beginWriteTransaction];
+    IntObject *obj1 = [IntObject createInRealm:realm withValue:@[@1]];
+    StringObject *obj2 = [StringObject createInRealm:realm withValue:@[@"a"]];
+    [realm commitWriteTransaction];
+    IntObject *alreadyFrozen = [obj1 freeze];
+
+    NSArray *frozen = [RLMRealm freezeObjects:@[obj1, obj2, alreadyFrozen]];
+    XCTAssertEqual(frozen.count, 3U);
+    for (RLMObject *obj in frozen) {
+        XCTAssertTrue(obj.frozen);
+    }
+    XCTAssertEqual([frozen[0] intCol], 1);
+    XCTAssertEqualObjects([frozen[1] stringCol], @"a");
+    XCTAssertEqual(frozen[2], alreadyFrozen);
+    XCTAssertEqual([frozen[0] realm], [frozen[1] realm]);
+
+    NSArray *frozenResults = [RLMRealm freezeObjects:[IntObject allObjects]];
+    XCTAssertEqual(frozenResults.count, 1U);
+    XCTAssertTrue([frozenResults[0] isFrozen]);
+
+    RLMAssertThrowsWithReason([RLMRealm freezeObjects:@[[IntObject new]]], @"Unmanaged objects cannot be frozen.");
+    RLMAssertThrowsWithReason([RLMRealm freezeObjects:@[@1]], @"which is not a Realm object");
+}
+
+- (void)testThawObjects {
+    RLMRealm *realm = RLMRealm.defaultRealm;
+    [realm beginWriteTransaction];
+    IntObject *obj1 = [IntObject createInRealm:realm withValue:@[@1]];
+    IntObject *obj2 = [IntObject createInRealm:realm withValue:@[@2]];
+    [realm commitWriteTransaction];
+
+    NSArray *frozen = [RLMRealm freezeObjects:@[obj1, obj2]];
+    [realm beginWriteTransaction];
+    [realm deleteObject:obj1];
+    obj2.intCol = 3;
+    [realm commitWriteTransaction];
+
+    NSArray *thawed = [RLMRealm thawObjects:[frozen arrayByAddingObject:obj2]];
+    XCTAssertEqual(thawed.count, 3U);
+    XCTAssertEqualObjects(thawed[0], NSNull.null);
+    XCTAssertFalse([thawed[1] isFrozen]);
+    XCTAssertEqual([thawed[1] intCol], 3);
+    XCTAssertEqual(thawed[2], obj2);
+}
+
 @end
@@ -140,6 +140,35 @@
     XCTAssertNil([[IntObject allObjects] objectsAtIndexes:indexSet]);
 }
 
+- (void)testCompactObjectArray {
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    XCTAssertEqual([IntObject allObjects].compactObjectArray.count, 0U);
+    [realm beginWriteTransaction];
+    for (int i = 0; i < 10; ++i) {
+        [IntObject createInDefaultRealmWithValue:@[@(i)]];
+    }
+    [realm commitWriteTransaction];
+
+    NSArray<IntObject *> *array = [[IntObject objectsWhere:@"intCol >= 5"] compactObjectArray];
+    XCTAssertEqual(array.count, 5U);
+    XCTAssertEqual(array[0].intCol, 5);
+    XCTAssertEqual(array.lastObject.intCol, 9);
+    // Each access creates a new object
+    XCTAssertNotEqual(array[0], array[0]);
+    XCTAssertEqualObjects(array[0], array[0]);
+    XCTAssertEqual([array indexOfObject:array[2]], 2U);
+    XCTAssertEqual([array indexOfObjectIdenticalTo:array[2]], (NSUInteger)NSNotFound);
+    RLMAssertThrowsWithReasonMatching(array[5], @"out of bounds");
+
+    [realm beginWriteTransaction];
+    array[1].intCol = 20;
+    [realm deleteObject:array[0]];
+    [realm commitWriteTransaction];
+    XCTAssertEqual(array.count, 5U);
+    XCTAssertEqual(array[1].intCol, 20);
+    RLMAssertThrowsWithReasonMatching(array[0], @"deleted or invalidated");
+}
+
 - (void)testValueForKey {
     RLMRealm *realm = self.realmWithTestPath;
 
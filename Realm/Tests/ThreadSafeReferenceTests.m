@@ -270,4 +270,116 @@
     XCTAssertEqualObjects(@"Andrea", ((OwnerObject *)unaccessedDogB.owners[0]).name);
 }
 
+- (void)testPassMaterializedResultsReference {
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    [realm transactionWithBlock:^{
+        for (int i = 0; i < 100; ++i) {
+            [IntObject createInRealm:realm withValue:@[@(i)]];
+        }
+    }];
+
+    RLMResults<IntObject *> *results = [IntObject objectsInRealm:realm where:@"intCol >= 50"];
+    RLMThreadSafeReference *snapshotRef = [RLMThreadSafeReference referenceWithMaterializedResults:results live:NO];
+    RLMThreadSafeReference *liveRef = [RLMThreadSafeReference referenceWithMaterializedResults:results live:YES];
+    RLMThreadSafeReference *staleRef = [RLMThreadSafeReference referenceWithMaterializedResults:results live:YES];
+    [self dispatchAsyncAndWait:^{
+        RLMRealm *realm = [RLMRealm defaultRealm];
+        RLMResults<IntObject *> *snapshot = [self assertResolve:realm reference:snapshotRef];
+        XCTAssertTrue(snapshot.frozen);
+        XCTAssertEqual(snapshot.count, 50U);
+
+        RLMResults<IntObject *> *live = [self assertResolve:realm reference:liveRef];
+        XCTAssertFalse(live.frozen);
+        XCTAssertEqualObjects(live.realm, realm);
+        XCTAssertEqual(live.count, 50U);
+        XCTAssertEqual(live[0].intCol, 50);
+
+        [realm transactionWithBlock:^{
+            [realm deleteObject:live[0]];
+        }];
+        XCTAssertEqual(live.count, 49U);
+        XCTAssertEqual(snapshot.count, 50U);
+    }];
+
+    // The target Realm is now newer than the source version, so the query is
+    // run again for live results
+    [self dispatchAsyncAndWait:^{
+        RLMRealm *realm = [RLMRealm defaultRealm];
+        RLMResults<IntObject *> *live = [self assertResolve:realm reference:staleRef];
+        XCTAssertEqual(live.count, 49U);
+        XCTAssertEqual(live[0].intCol, 51);
+    }];
+}
+
+- (void)testInvalidMaterializedResultsReferenceConstruction {
+    RLMAssertThrowsWithReasonMatching([RLMThreadSafeReference referenceWithMaterializedResults:(id)@[] live:NO],
+                                      @"which is not an RLMResults");
+    RLMThreadSafeReference *ref = [RLMThreadSafeReference referenceWithMaterializedResults:[IntObject allObjects]
+                                                                                      live:NO];
+    RLMAssertThrowsWithReasonMatching([[self realmWithTestPath] resolveThreadSafeReference:ref],
+                                      @"different Realm file");
+}
+
+- (void)testPassThreadSafeBatchReferenceToObjects {
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    [realm transactionWithBlock:^{
+        for (int i = 0; i < 100; ++i) {
+            [IntObject createInRealm:realm withValue:@[@(i)]];
+        }
+        [StringObject createInRealm:realm withValue:@[@"a"]];
+    }];
+
+    RLMResults<IntObject *> *results = [IntObject objectsInRealm:realm where:@"intCol >= 50"];
+    RLMThreadSafeBatchReference *resultsRef = [RLMThreadSafeBatchReference referenceWithObjects:results];
+    RLMThreadSafeBatchReference *mixedRef = [RLMThreadSafeBatchReference referenceWithObjects:
+                                             @[results[0], [StringObject allObjectsInRealm:realm][0], results[1]]];
+    XCTAssertEqual(resultsRef.count, 50U);
+    XCTAssertEqual(mixedRef.count, 3U);
+
+    [realm transactionWithBlock:^{
+        [realm deleteObjects:[IntObject objectsInRealm:realm where:@"intCol < 60"]];
+    }];
+
+    [self dispatchAsyncAndWait:^{
+        RLMRealm *realm = [RLMRealm defaultRealm];
+        XCTAssertFalse(resultsRef.isInvalidated);
+        NSArray<IntObject *> *objects = [realm resolveThreadSafeBatchReference:resultsRef];
+        XCTAssertTrue(resultsRef.isInvalidated);
+        RLMAssertThrowsWithReasonMatching([realm resolveThreadSafeBatchReference:resultsRef],
+                                          @"Can only resolve a thread safe reference once");
+
+        // The objects deleted after the reference was created are omitted
+        XCTAssertEqual(objects.count, 40U);
+        XCTAssertEqual(objects[0].intCol, 60);
+        XCTAssertEqual(objects.lastObject.intCol, 99);
+        XCTAssertEqual(objects[0], objects[0]);
+        XCTAssertEqualObjects(objects[0].realm, realm);
+
+        NSArray *mixed = [realm resolveThreadSafeBatchReference:mixedRef];
+        XCTAssertEqual(mixed.count, 1U);
+        XCTAssertEqualObjects([mixed[0] stringCol], @"a");
+    }];
+}
+
+- (void)testInvalidThreadSafeBatchReferenceConstruction {
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    RLMAssertThrowsWithReasonMatching([RLMThreadSafeBatchReference referenceWithObjects:@[[StringObject new]]],
+                                      @"Cannot construct reference to unmanaged object");
+    RLMAssertThrowsWithReasonMatching([RLMThreadSafeBatchReference referenceWithObjects:@[@1]],
+                                      @"which is not a Realm object");
+
+    RLMRealm *otherRealm = [self realmWithTestPath];
+    [realm beginWriteTransaction];
+    [otherRealm beginWriteTransaction];
+    StringObject *obj = [StringObject createInRealm:realm withValue:@[@"a"]];
+    StringObject *other = [StringObject createInRealm:otherRealm withValue:@[@"b"]];
+    RLMAssertThrowsWithReasonMatching([RLMThreadSafeBatchReference referenceWithObjects:(@[obj, other])],
+                                      @"managed by different Realms");
+    [realm deleteObject:obj];
+    RLMAssertThrowsWithReasonMatching([RLMThreadSafeBatchReference referenceWithObjects:@[obj]],
+                                      @"Cannot construct reference to invalidated object");
+    [otherRealm cancelWriteTransaction];
+    [realm cancelWriteTransaction];
+}
+
 @end
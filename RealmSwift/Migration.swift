@@ -33,6 +33,28 @@ public typealias MigrationBlock = (_ migration: Migration, _ oldSchemaVersion: U
 /// An object class used during migrations.
 public typealias MigrationObject = DynamicObject
 
+/**
+ The type of a block used to migrate each object of a type during a chunked migration.
+
+ - parameter object:           The object to migrate, as defined by the current schema.
+ - parameter oldSchemaVersion: The schema version of the Realm before the migration began.
+
+ - see: `Realm.Configuration.chunkedMigrationBlocks`
+ */
+public typealias ChunkedMigrationBlock = (_ object: ObjectBase, _ oldSchemaVersion: UInt64) -> Void
+
+/**
+ The type of a block used to compute the value of a lazily migrated property from the other properties of an
+ object.
+
+ - parameter object: The object whose property value is being computed, as defined by the current schema.
+
+ - returns: The value of the property, which may be `nil` for optional properties.
+
+ - see: `Realm.Configuration.lazyPropertyMigrationBlocks`
+ */
+public typealias LazyPropertyMigrationBlock = (_ object: ObjectBase) -> Any?
+
 /**
  A block type which provides both the old and new versions of an object in the Realm. Object
  properties can only be accessed using subscripting.
@@ -169,6 +191,52 @@ extension Realm {
         rlmMigration.renameProperty(forClass: typeName, oldName: oldName, newName: newName)
     }
 
+    // MARK: Bulk Property Operations
+
+    /**
+     Copies the values of a property from the old Realm schema to a property in the new Realm schema.
+
+     This operates directly on the underlying storage and does not create any objects, making it much faster than
+     setting the values from within `enumerateObjects(ofType:_:)` for large tables. If the types of the two properties
+     differ, each value is converted to the new type, and an exception is thrown if a value cannot be converted.
+
+     - parameter typeName: The name of the class whose property should be copied. This class must be present in both
+                           the old and new Realm schemas.
+     - parameter oldName:  The name of the property in the old Realm schema to read values from.
+     - parameter newName:  The name of the property in the new Realm schema to write values to.
+     */
+    public func copyProperty(onType typeName: String, from oldName: String, to newName: String) {
+        rlmMigration.copyProperty(forClass: typeName, oldName: oldName, newName: newName)
+    }
+
+    /**
+     Converts the values of a property whose type has changed between the old and new Realm schemas.
+
+     - parameter typeName: The name of the class whose property should be converted. This class must be present in
+                           both the old and new Realm schemas.
+     - parameter property: The name of the property to convert.
+     */
+    public func convertProperty(onType typeName: String, named property: String) {
+        rlmMigration.convertProperty(forClass: typeName, property: property)
+    }
+
+    /**
+     Computes the values of one or more properties in the new Realm schema from one or more properties in the old Realm
+     schema, using a C function operating on batches of typed values.
+
+     - parameter typeName:      The name of the class whose properties should be transformed. This class must be
+                                present in both the old and new Realm schemas.
+     - parameter oldProperties: The names of the properties in the old Realm schema to read.
+     - parameter newProperties: The names of the properties in the new Realm schema to write.
+     - parameter context:       An arbitrary pointer which is passed to each invocation of `function`.
+     - parameter function:      The function which computes the new values.
+     */
+    public func transformProperties(onType typeName: String, from oldProperties: [String], to newProperties: [String],
+                                    context: UnsafeMutableRawPointer? = nil, function: RLMMigrationColumnFunction) {
+        rlmMigration.transformProperties(forClass: typeName, oldProperties: oldProperties,
+                                         newProperties: newProperties, function: function, context: context)
+    }
+
     internal init(_ rlmMigration: RLMMigration) {
         self.rlmMigration = rlmMigration
     }
@@ -212,6 +212,19 @@ public protocol ChangeEventDelegate: AnyObject {
     /// Invoked when a change event has been received.
     /// - Parameter changeEvent:The change event in BSON format.
     func changeStreamDidReceive(changeEvent: AnyBSON?)
+    /// Invoked with all of the change events which were received from the server at once. The default
+    /// implementation calls `changeStreamDidReceive(changeEvent:)` for each event.
+    /// - Parameter changeEvents: The change events in BSON format.
+    func changeStreamDidReceive(changeEvents: [AnyBSON?])
+}
+
+extension ChangeEventDelegate {
+    /// :nodoc:
+    public func changeStreamDidReceive(changeEvents: [AnyBSON?]) {
+        for changeEvent in changeEvents {
+            changeStreamDidReceive(changeEvent: changeEvent)
+        }
+    }
 }
 
 extension MongoCollection {
@@ -297,6 +310,38 @@ extension MongoCollection {
         }
     }
 
+    /// Encodes the provided values to BSON and inserts them using a separate request for each chunk of documents.
+    /// If any values are missing identifiers, they will be generated.
+    ///
+    /// Each chunk is only encoded when its request is sent, and at most `maxConcurrentRequests` requests are in
+    /// flight at once. No further chunks are sent once a chunk fails to insert, but the requests which are already in
+    /// flight are allowed to finish before `completion` is called.
+    /// - Parameters:
+    ///   - documents: The `Document` values to insert.
+    ///   - chunkSize: The maximum number of documents to insert in each request.
+    ///   - maxConcurrentRequests: The maximum number of requests to have in flight at once.
+    ///   - onProgress: Called after each chunk is inserted with the number of documents inserted so far and the total
+    ///                 number of documents. Calls are made in order on a serial background queue and never
+    ///                 concurrently, and all of them are made before `completion` is called.
+    ///   - completion: Called once all of the requests have finished with the ids of the inserted documents for each
+    ///                 chunk and the first error to occur. The ids for chunks which were not inserted are empty.
+    public func insertMany(_ documents: [Document],
+                           chunkSize: Int,
+                           maxConcurrentRequests: Int = 4,
+                           onProgress: ((Int, Int) -> Void)? = nil,
+                           _ completion: @escaping ([[AnyBSON]], Error?) -> Void) {
+        let bson = ObjectiveCSupport.convert(object: .array(documents.map {.document($0)}))
+        var progressBlock: RLMMongoInsertManyProgressBlock?
+        if let onProgress = onProgress {
+            progressBlock = { inserted, total in onProgress(Int(inserted), Int(total)) }
+        }
+        self.__insertManyDocuments(bson as! [[String: RLMBSON]], chunkSize: UInt(chunkSize),
+                                   maxConcurrentRequests: UInt(maxConcurrentRequests),
+                                   progressBlock: progressBlock) { objectIds, error in
+            completion(objectIds.map { $0.compactMap(ObjectiveCSupport.convert) }, error)
+        }
+    }
+
     /// Finds the documents in this collection which match the provided filter.
     /// - Parameters:
     ///   - filter: A `Document` as bson that should match the query.
@@ -333,6 +378,68 @@ extension MongoCollection {
         }
     }
 
+    /// Finds the documents in this collection which match the provided filter, one page at a time.
+    ///
+    /// Documents are fetched in order of `_id` using a separate request for each page, and the next page is not
+    /// requested until `onPage` returns, so only a single page of documents is held in memory at once.
+    ///
+    /// Each page after the first only matches documents whose `_id` compares greater than the last one delivered, which
+    /// in MongoDB only matches values of the same type, so the `_id` of every matching document must be of the same type.
+    /// If documents with an `_id` of a different type would have been skipped, `completion` is called with an error.
+    /// - Parameters:
+    ///   - filter: A `Document` as bson that should match the query.
+    ///   - options: `FindOptions` to use when executing the command. The `limit` applies to the total number of
+    ///              documents returned, and `_id` is always included in the projection. A `sort` cannot be used.
+    ///   - pageSize: The maximum number of documents in each page.
+    ///   - onPage: Called with each page of documents. Return `false` to stop without fetching any further pages.
+    ///   - completion: Called once all of the pages have been delivered, with an error if one occurs.
+    public func find(filter: Document,
+                     options: FindOptions = FindOptions(),
+                     pageSize: Int,
+                     onPage: @escaping ([Document]) -> Bool,
+                     _ completion: @escaping (Error?) -> Void) {
+        let bson = ObjectiveCSupport.convert(object: .document(filter))
+        self.__findWhere(bson as! [String: RLMBSON], options: options, pageSize: UInt(pageSize), pageBlock: { documents in
+            onPage(documents.map { $0.mapValues { ObjectiveCSupport.convert(object: $0) } })
+        }, completion: completion)
+    }
+
+    /// Finds the documents in this collection which match the provided filter and writes them directly into a Realm
+    /// as objects of the given type.
+    ///
+    /// The documents are converted straight from BSON to Realm values without creating intermediate `Document`
+    /// values, and all of them are written in a single write transaction. Each document field is stored in the
+    /// property of the same name unless `fieldMapping` maps the field name to a different property name, and fields
+    /// which do not correspond to a property are ignored. If the type has a primary key, existing objects with a
+    /// matching primary key are updated, and only the properties whose values have changed are written. Properties
+    /// of newly created objects which are missing from the document are set to their default values, and importing
+    /// fails if a required property has neither a value nor a default value.
+    /// - Parameters:
+    ///   - filter: A `Document` as bson that should match the query.
+    ///   - options: `FindOptions` to use when executing the command.
+    ///   - configuration: The configuration of the Realm to write the objects to.
+    ///   - type: The type of object to create. Must not be an `EmbeddedObject` type.
+    ///   - fieldMapping: A dictionary which maps document field names to property names.
+    ///   - completion: Called on a background thread with the number of documents which were imported, or an error
+    ///                 if one occurs.
+    public func importDocuments<T: Object>(filter: Document,
+                                           options: FindOptions = FindOptions(),
+                                           configuration: Realm.Configuration,
+                                           type: T.Type,
+                                           fieldMapping: [String: String] = [:],
+                                           _ completion: @escaping MongoCountBlock) {
+        let bson = ObjectiveCSupport.convert(object: .document(filter))
+        self.__importDocumentsWhere(bson as! [String: RLMBSON], options: options,
+                                    configuration: configuration.rlmConfiguration,
+                                    className: type.className(), fieldMapping: fieldMapping) { count, error in
+            if let error = error {
+                completion(.failure(error))
+            } else {
+                completion(.success(count))
+            }
+        }
+    }
+
     /// Returns one document from a collection or view which matches the
     /// provided filter. If multiple documents satisfy the query, this method
     /// returns the first document according to the query's sort order or natural
@@ -961,6 +1068,10 @@ private class ChangeEventDelegateProxy: RLMChangeEventDelegate {
         let bson = ObjectiveCSupport.convert(object: changeEvent)
         proxyDelegate?.changeStreamDidReceive(changeEvent: bson)
     }
+
+    func changeStreamDidReceiveChangeEvents(_ changeEvents: [RLMBSON]) {
+        proxyDelegate?.changeStreamDidReceive(changeEvents: changeEvents.map { ObjectiveCSupport.convert(object: $0) })
+    }
 }
 
 #if !(os(iOS) && (arch(i386) || arch(arm)))
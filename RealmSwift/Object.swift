@@ -191,6 +191,32 @@ extension Object: RealmCollectionValue {
         }
     }
 
+    /**
+     Returns the value at the end of a key path which follows links to single objects, such as `"dog.owner.name"`.
+
+     This does not create an object for each object along the path, and returns `nil` if any link along the
+     path is `nil`. Values are returned as their Objective-C representations, as with `value(forKey:)`.
+
+     - parameter linkPath: A key path in which every property but the last is a link to a single object.
+     - returns: The value of the last property in the key path.
+     */
+    public func value(forLinkPath linkPath: String) -> Any? {
+        return RLMObjectBaseValueForLinkPath(self, linkPath)
+    }
+
+    /**
+     Returns the object's properties encoded as a binary BSON document.
+
+     The values are read directly from the Realm file without creating any intermediate objects. Embedded objects
+     are encoded as nested documents and links to other objects as the linked object's primary key, or `null` if it
+     does not have one. Linking objects properties are omitted.
+
+     This can only be called on managed objects.
+     */
+    public func bsonDocument() -> Data {
+        return RLMObjectBaseBsonDocument(self)
+    }
+
     // MARK: Notifications
 
     /**
@@ -204,6 +204,32 @@ import Realm.Private
                 block(SyncSession.Progress(transferred: transferred, transferrable: transferrable))
             }
         }
+
+        /**
+         Register a progress notification block which is called at most once
+         per `minimumInterval` seconds.
+
+         Progress updates which arrive while the block is waiting to be called
+         or is still running are coalesced, and only the most recent one is
+         delivered. Updates are also held back until at least `minimumInterval`
+         seconds have passed and at least `minimumDelta` more bytes have been
+         downloaded since the previous call to the block. An update which
+         reports that the download has completed is always delivered.
+
+         - parameter queue: The queue to deliver progress notifications on.
+         - parameter minimumInterval: The minimum number of seconds between calls to the block.
+         - parameter minimumDelta: The minimum number of downloaded bytes between calls to the block.
+         - parameter block: The block to invoke when notifications are available.
+         */
+        public func addProgressNotification(queue: DispatchQueue = .main,
+                                            minimumInterval: TimeInterval,
+                                            minimumDelta: Int = 0,
+                                            block: @escaping (SyncSession.Progress) -> Void) {
+            rlmTask.addProgressNotification(on: queue, minimumInterval: minimumInterval,
+                                            minimumDelta: UInt(minimumDelta)) { transferred, transferrable in
+                block(SyncSession.Progress(transferred: transferred, transferrable: transferrable))
+            }
+        }
     }
 
     // MARK: Transactions
@@ -855,6 +881,27 @@ import Realm.Private
         return RLMObjectThaw(obj) as? T
     }
 
+    /**
+     Returns frozen (immutable) snapshots of each of the given objects.
+
+     This is equivalent to calling `freeze(_:)` on each object, but the frozen Realm and the type of each object are
+     only looked up once for each run of objects from the same Realm and of the same type.
+     */
+    public func freeze<T: ObjectBase>(_ objects: [T]) -> [T] {
+        return RLMRealm.freezeObjects(objects as NSArray) as! [T]
+    }
+
+    /**
+     Returns live (mutable) references to each of the given frozen objects.
+
+     This is equivalent to calling `thaw(_:)` on each object, but the live Realm is only opened once for each frozen
+     Realm. The returned array has one element for each of the given objects, which is `nil` for objects which
+     have been deleted in the live Realm.
+     */
+    public func thaw<T: ObjectBase>(_ objects: [T]) -> [T?] {
+        return RLMRealm.thawObjects(objects as NSArray).map { $0 as? T }
+    }
+
     /**
      Returns a frozen (immutable) snapshot of the given collection.
 
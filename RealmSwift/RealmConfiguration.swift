@@ -198,6 +198,48 @@ extension Realm {
 
         private var _deleteRealmIfMigrationNeeded: Bool = false
 
+        /**
+         Blocks which migrate the objects of each type in chunks after the schema has been updated, keyed by the name
+         of the object type.
+
+         When the schema version is increased, the schema changes and `migrationBlock` are applied in a single write
+         transaction as normal, and then each object of the given types is passed to the corresponding block,
+         committing a write transaction after every `migrationChunkSize` objects. The position in each type is
+         persisted in the Realm file along with each chunk, so if the process is terminated partway through, the
+         chunked migration is resumed from the last committed chunk the next time the Realm is opened.
+
+         The Realm is not returned until the chunked migration has completed, and opening it with a configuration
+         which does not provide the required blocks will fail until it has. Other Realms can be opened while the
+         migration runs. If the same file is opened elsewhere during the migration, that open takes part in
+         completing it and also waits for it to finish.
+         */
+        public var chunkedMigrationBlocks: [String: ChunkedMigrationBlock]?
+
+        /// The number of objects to migrate in each write transaction when performing a chunked migration.
+        public var migrationChunkSize: UInt = 1000
+
+        /**
+         A block called after each chunk of a chunked migration is committed. It is passed the number of objects
+         which have been migrated so far and the total number of objects which needed to be migrated.
+         */
+        public var migrationProgressBlock: ((_ migratedObjects: Int, _ totalObjects: Int) -> Void)?
+
+        /**
+         Blocks which compute the values of properties derived from other properties of the same object, keyed by
+         `"ClassName.propertyName"`.
+
+         When the schema version is increased, the given properties are marked as pending rather than being filled
+         in by the migration. Reading a pending property computes its value by calling the block, and a background
+         sweep stores the computed values for all objects of the type in chunks of `migrationChunkSize` objects.
+
+         Only the objects which exist when the migration is scheduled are migrated, and the blocks must compute the
+         value solely from the object passed to them. Setting a pending property on one of those objects before the
+         sweep has reached it throws an exception. Querying, sorting, distinct,
+         aggregate functions and `value(forKey:)` on collections throw an exception for a pending property until the
+         sweep has completed. Opening the Realm without the blocks for every pending property throws an error.
+         */
+        public var lazyPropertyMigrationBlocks: [String: LazyPropertyMigrationBlock]?
+
         /**
          A block called when opening a Realm for the first time during the
          life of a process to determine if it should be compacted before being
@@ -267,6 +309,20 @@ extension Realm {
             configuration.readOnly = self.readOnly
             configuration.schemaVersion = self.schemaVersion
             configuration.migrationBlock = self.migrationBlock.map { accessorMigrationBlock($0) }
+            configuration.chunkedMigrationBlocks = self.chunkedMigrationBlocks?.mapValues { block in
+                return { object, oldSchemaVersion in
+                    block(unsafeBitCast(object, to: ObjectBase.self), oldSchemaVersion)
+                }
+            }
+            configuration.migrationChunkSize = self.migrationChunkSize
+            configuration.migrationProgressBlock = self.migrationProgressBlock.map { block in
+                return { migrated, total in block(Int(migrated), Int(total)) }
+            }
+            configuration.lazyPropertyMigrationBlocks = self.lazyPropertyMigrationBlocks?.mapValues { block in
+                return { object in
+                    block(unsafeBitCast(object, to: ObjectBase.self)).map { dynamicBridgeCast(fromSwift: $0) }
+                }
+            }
             configuration.deleteRealmIfMigrationNeeded = self.deleteRealmIfMigrationNeeded
             if let shouldCompactOnLaunch = self.shouldCompactOnLaunch {
                 configuration.shouldCompactOnLaunch = ObjectiveCSupport.convert(object: shouldCompactOnLaunch)
@@ -296,6 +352,18 @@ extension Realm {
                     rlmMigration(migration.rlmMigration, schemaVersion)
                 }
             }
+            configuration.chunkedMigrationBlocks = rlmConfiguration.chunkedMigrationBlocks?.mapValues { block in
+                return { object, oldSchemaVersion in
+                    block(unsafeBitCast(object, to: RLMObject.self), oldSchemaVersion)
+                }
+            }
+            configuration.migrationChunkSize = rlmConfiguration.migrationChunkSize
+            configuration.migrationProgressBlock = rlmConfiguration.migrationProgressBlock.map { block in
+                return { migrated, total in block(UInt(migrated), UInt(total)) }
+            }
+            configuration.lazyPropertyMigrationBlocks = rlmConfiguration.lazyPropertyMigrationBlocks?.mapValues { block in
+                return { object in block(unsafeBitCast(object, to: RLMObject.self)) }
+            }
             configuration.deleteRealmIfMigrationNeeded = rlmConfiguration.deleteRealmIfMigrationNeeded
             configuration.shouldCompactOnLaunch = rlmConfiguration.shouldCompactOnLaunch.map(ObjectiveCSupport.convert)
             configuration.customSchema = rlmConfiguration.customSchema
@@ -125,3 +125,21 @@ extension Projection: KeypathSortable {}
 }
 
 extension Results: Encodable where Element: Encodable {}
+
+extension Results where Element: ObjectBase {
+    /**
+     Returns the objects in the results encoded as binary BSON documents.
+
+     The documents are written one after another into a single buffer in the order of the results, which is the same
+     layout as a `.bson` file produced by `mongodump`. The values are read directly from the Realm file without
+     creating any intermediate objects. Embedded objects are encoded as nested documents and links to other objects
+     as the linked object's primary key, or `null` if it does not have one.
+
+     - parameter keyPaths: The names of the properties to include in each document, or `nil` to include every
+                           property other than `LinkingObjects` properties.
+     - returns: A buffer containing one BSON document for each object.
+     */
+    public func bsonDocuments(keyPaths: [String]? = nil) -> Data {
+        return (collection as! RLMResults<AnyObject>).bsonDocuments(forKeyPaths: keyPaths)
+    }
+}
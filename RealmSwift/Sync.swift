@@ -602,6 +602,41 @@ public extension SyncSession {
                                                 block(Progress(transferred: transferred, transferrable: transferrable))
         }
     }
+
+    /**
+     Register a progress notification block which is invoked at most once per
+     `minimumInterval` seconds.
+
+     This behaves like `addProgressNotification(for:mode:block:)`, except that
+     progress updates which arrive while the block is waiting to be called or is
+     still running are coalesced, and only the most recent one is delivered.
+     Updates are also held back until at least `minimumInterval` seconds have
+     passed and at least `minimumDelta` more bytes have been transferred since
+     the previous call to the block. An update which reports that all
+     transferrable bytes have been transferred is always delivered.
+
+     - parameter direction:       The transfer direction (upload or download) to track in this progress notification block.
+     - parameter mode:            The desired behavior of this progress notification block.
+     - parameter minimumInterval: The minimum number of seconds between calls to the block.
+     - parameter minimumDelta:    The minimum number of transferred bytes between calls to the block.
+     - parameter block:           The block to invoke when notifications are available.
+
+     - returns: A token which must be held for as long as you want notifications to be delivered.
+     */
+    func addProgressNotification(for direction: ProgressDirection,
+                                 mode: ProgressMode,
+                                 minimumInterval: TimeInterval,
+                                 minimumDelta: Int = 0,
+                                 block: @escaping (Progress) -> Void) -> ProgressNotificationToken? {
+        return __addProgressNotification(for: (direction == .upload ? .upload : .download),
+                                         mode: (mode == .reportIndefinitely
+                                            ? .reportIndefinitely
+                                            : .forCurrentlyOutstandingWork),
+                                         minimumInterval: minimumInterval,
+                                         minimumDelta: UInt(minimumDelta)) { transferred, transferrable in
+                                                block(Progress(transferred: transferred, transferrable: transferrable))
+        }
+    }
 }
 
 extension Realm {
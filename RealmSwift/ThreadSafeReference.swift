@@ -116,6 +116,31 @@ public protocol ThreadConfined {
     }
 }
 
+extension ThreadSafeReference {
+    /**
+     Create a thread-safe reference to the objects currently in the given results.
+
+     Unlike `init(to:)`, which runs the query again in the target Realm when the resolved results are first
+     accessed, this evaluates the query in the source Realm if it has not already been evaluated and hands over the
+     keys of the matching objects.
+
+     If `live` is `false`, resolving the reference returns frozen results containing exactly the objects which
+     matched at the source version, and the query is never run again.
+
+     If `live` is `true`, resolving the reference returns live results in the target Realm. If the target Realm is at
+     the source version after resolving, the results contain the objects which matched in the source Realm without
+     running the query again. Otherwise the query is run again in the target Realm.
+
+     - parameter results: The results to create a thread-safe reference to.
+     - parameter live:    Whether the resolved results should be live results in the target Realm rather than a
+                          frozen snapshot.
+     */
+    public init<Element>(materializing results: Confined, live: Bool = false) where Confined == Results<Element> {
+        objectiveCReference = RLMThreadSafeReference(materializedResults: results.collection as! RLMResults<AnyObject>,
+                                                     live: live)
+    }
+}
+
 // MARK: ThreadSafe propertyWrapper
 
 /**
@@ -68,6 +68,7 @@ command:
   test-catalyst:        tests Mac Catalyst framework
   test-catalyst-swift:  tests RealmSwift Mac Catalyst framework
   test-swiftpm:         tests ObjC and Swift macOS frameworks via SwiftPM
+  benchmark-app-transport: benchmarks the app networking stack against an in-process stub server
   test-swiftui-ios:         tests SwiftUI framework UI tests
   test-swiftui-server-osx:  tests Server Sync in SwiftUI
   verify:               verifies docs, osx, osx-swift, ios-static, ios-dynamic, ios-swift, ios-device, swiftui-ios in both Debug and Release configurations, swiftlint
@@ -642,6 +643,12 @@ case "$COMMAND" in
         exit 0
         ;;
 
+    benchmark-app-transport)
+        xcrun swift package resolve
+        xcrun swift test --configuration release -Xcc -g0 --filter SwiftAppTransportBenchmarks
+        exit 0
+        ;;
+
     test-swiftpm*)
         SANITIZER=$(echo "$COMMAND" | cut -d - -f 3)
         SWIFT_TEST_FLAGS=(-Xcc -g0)